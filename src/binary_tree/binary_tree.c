@@ -12,25 +12,96 @@
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "binary_tree.h"
 
+/** The number of nodes in the first slab a tree allocates. Later slabs double in size. */
+#define NODE_SLAB_MIN_CAPACITY 64
+
+/** The largest slab a tree will allocate, in nodes. */
+#define NODE_SLAB_MAX_CAPACITY 65536
+
+struct node_slab {
+    struct node_slab *next; /** The previously allocated slab. */
+    unsigned int capacity;  /** The number of nodes in this slab. */
+    unsigned int used;      /** The number of nodes handed out from this slab so far. */
+    struct node nodes[];
+};
+
 /**
  * @brief Create a new binary tree node
  *
  * @param data The data to save in the node
- * @return struct node* A pointer to the new node
+ * @return struct node* A pointer to the new node, or NULL if allocation fails
  */
 struct node *node_init(int data)
 {
     struct node *new_node = malloc(sizeof(*new_node));
+    if (!new_node) {
+        return NULL;
+    }
     new_node->data = data;
+    new_node->size = 1;
     new_node->left = NULL;
     new_node->right = NULL;
 
     return new_node;
 }
 
+/**
+ * @brief Get the number of nodes in a subtree
+ *
+ * @param node The root of the subtree
+ *
+ * @return unsigned int The size stored in the node, or 0 for an empty subtree
+ */
+static unsigned int subtree_size(struct node *node)
+{
+    return node ? node->size : 0;
+}
+
+/**
+ * @brief Push a node onto an iterator's stack, growing the stack if needed
+ *
+ * If the stack cannot grow, the iterator is marked as failed so that the walk stops instead of
+ * silently skipping the nodes that were never pushed.
+ *
+ * @param iter The iterator to push onto
+ * @param node The node to push
+ *
+ * @return int 1 on success, or 0 if the stack could not be grown
+ */
+static int iter_push(struct binary_tree_iter *iter, struct node *node)
+{
+    if (iter->depth == iter->capacity) {
+        unsigned int capacity = iter->capacity ? iter->capacity * 2 : 32;
+        struct node **stack = realloc(iter->stack, sizeof(*stack) * capacity);
+        if (!stack) {
+            iter->failed = 1;
+            return 0;
+        }
+        iter->stack = stack;
+        iter->capacity = capacity;
+    }
+
+    iter->stack[iter->depth++] = node;
+    return 1;
+}
+
+/**
+ * @brief Push a node and its chain of left descendants onto an iterator's stack
+ *
+ * @param iter The iterator to push onto
+ * @param node The first node of the chain
+ */
+static void iter_push_left_spine(struct binary_tree_iter *iter, struct node *node)
+{
+    while (node && iter_push(iter, node)) {
+        node = node->left;
+    }
+}
+
 /**
  * @brief Free memory used by a binary tree node
  *
@@ -50,14 +121,42 @@ void node_free(struct node *node)
  */
 void binary_tree_free(struct node *root)
 {
-    if (!root) {
-        return;
+    /*
+     * Rotate left children up until the root has none, then free it and move on to its right
+     * subtree. This flattens the tree as it goes and needs no stack at all.
+     */
+    while (root) {
+        if (root->left) {
+            struct node *left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        }
+        else {
+            struct node *right = root->right;
+            free(root);
+            root = right;
+        }
     }
+}
 
-    binary_tree_free(root->left);
-    binary_tree_free(root->right);
+/**
+ * @brief Hang a new leaf off a tree, growing the size of every subtree on the way down
+ *
+ * @param root The root node of the tree, which must not already contain the leaf's value
+ * @param leaf The node to link into the tree
+ */
+static void link_leaf(struct node *root, struct node *leaf)
+{
+    struct node *current = root;
+    struct node **link = NULL;
 
-    free(root);
+    while (current) {
+        ++current->size;
+        link = (leaf->data < current->data) ? &current->left : &current->right;
+        current = *link;
+    }
+    *link = leaf;
 }
 
 /**
@@ -66,7 +165,8 @@ void binary_tree_free(struct node *root)
  * @param root The root node of the tree
  * @param data The value to add to the tree
  *
- * @return struct node* A pointer to the new leaf node
+ * @return struct node* The root of the tree. If allocating the new node fails, the value is not
+ *         added, and for an empty tree NULL is returned.
  */
 struct node *binary_tree_insert(struct node *root, const int data)
 {
@@ -74,34 +174,93 @@ struct node *binary_tree_insert(struct node *root, const int data)
         return node_init(data);
     }
 
-    if (data < root->data) {
-        root->left = binary_tree_insert(root->left, data);
+    /* Duplicates are ignored, so make sure the value is new before growing any subtree sizes */
+    if (binary_tree_is_in_tree(root, data)) {
+        return root;
     }
-    else if (data > root->data) {
-        root->right = binary_tree_insert(root->right, data);
+
+    /* Allocate before linking, since link_leaf grows subtree sizes on its way down */
+    struct node *leaf = node_init(data);
+    if (leaf) {
+        link_leaf(root, leaf);
     }
 
     return root;
 }
 
 /**
- * @brief Count the number of nodes in a tree
+ * @brief Detach the node holding a value from a tree, shrinking subtree sizes on the way down
  *
- * @param root The tree to count
-
- * @return int The number of nodes in the tree
+ * A node with two children keeps its place in the tree and takes over its in-order successor's
+ * value. The successor, which has no left child, is detached instead.
+ *
+ * @param root Pointer to the root link of the tree, updated if the root is detached
+ * @param data The value to remove
+ *
+ * @return struct node* The detached node, or NULL if the value is not in the tree
  */
-unsigned int binary_tree_get_node_count(struct node *root)
+static struct node *unlink_value(struct node **root, int data)
 {
-    unsigned int cnt = 0;
+    if (!binary_tree_is_in_tree(*root, data)) {
+        return NULL;
+    }
 
-    if (!root) {
-        return 0;
+    struct node **link = root;
+    while ((*link)->data != data) {
+        --(*link)->size;
+        link = (data < (*link)->data) ? &(*link)->left : &(*link)->right;
     }
 
-    cnt = 1 + binary_tree_get_node_count(root->left) + binary_tree_get_node_count(root->right);
+    struct node *target = *link;
+    if (!target->left) {
+        *link = target->right;
+        return target;
+    }
+    if (!target->right) {
+        *link = target->left;
+        return target;
+    }
 
-    return cnt;
+    --target->size;
+    link = &target->right;
+    while ((*link)->left) {
+        --(*link)->size;
+        link = &(*link)->left;
+    }
+
+    struct node *successor = *link;
+    target->data = successor->data;
+    *link = successor->right;
+
+    return successor;
+}
+
+/**
+ * @brief Remove a value from a binary tree
+ *
+ * @param root The root node of the tree
+ * @param data The value to remove from the tree
+ *
+ * @return struct node* The root node of the tree after removal, which is NULL if the tree is
+ * now empty
+ */
+struct node *binary_tree_delete(struct node *root, const int data)
+{
+    node_free(unlink_value(&root, data));
+
+    return root;
+}
+
+/**
+ * @brief Count the number of nodes in a tree
+ *
+ * @param root The tree to count
+ *
+ * @return unsigned int The number of nodes in the tree
+ */
+unsigned int binary_tree_get_node_count(struct node *root)
+{
+    return subtree_size(root);
 }
 
 /**
@@ -109,23 +268,27 @@ unsigned int binary_tree_get_node_count(struct node *root)
  *
  * @param root The tree to check
  *
- * @return unsigned int The height of the tree
+ * @return unsigned int The height of the tree, or UINT_MAX if there was not enough memory to walk
+ *         it
  */
 unsigned int binary_tree_get_height(struct node *root)
 {
-    if (!root) {
-        return 0;
-    }
-
-    unsigned int left_height = binary_tree_get_height(root->left);
-    unsigned int right_height = binary_tree_get_height(root->right);
-
-    if (left_height >= right_height) {
-        return left_height + 1;
+    struct binary_tree_iter iter;
+    unsigned int height = 0;
+
+    /* A post-order walk keeps exactly the path from the root to the current node on its stack */
+    binary_tree_iter_init(&iter, root, BINARY_TREE_POSTORDER);
+    while (binary_tree_iter_next(&iter)) {
+        if (iter.depth + 1 > height) {
+            height = iter.depth + 1;
+        }
     }
-    else {
-        return right_height + 1;
+    if (binary_tree_iter_failed(&iter)) {
+        height = UINT_MAX;
     }
+    binary_tree_iter_free(&iter);
+
+    return height;
 }
 
 /**
@@ -141,24 +304,12 @@ int binary_tree_get_min(struct node *root)
         return INT_MAX;
     }
 
-    int min = root->data;
-    int left_min;
-    int right_min;
-
-    if (root->left) {
-        left_min = binary_tree_get_min(root->left);
-        if (left_min < min) {
-            min = left_min;
-        }
-    }
-    if (root->right) {
-        right_min = binary_tree_get_min(root->right);
-        if (right_min < min) {
-            min = right_min;
-        }
+    /* The smallest value is at the end of the left spine */
+    while (root->left) {
+        root = root->left;
     }
 
-    return min;
+    return root->data;
 }
 
 /**
@@ -174,24 +325,69 @@ int binary_tree_get_max(struct node *root)
         return INT_MAX;
     }
 
-    int max = root->data;
-    int left_max;
-    int right_max;
+    /* The largest value is at the end of the right spine */
+    while (root->right) {
+        root = root->right;
+    }
 
-    if (root->left) {
-        left_max = binary_tree_get_max(root->left);
-        if (left_max > max) {
-            max = left_max;
+    return root->data;
+}
+
+/**
+ * @brief Count the values in a tree that are smaller than a given value
+ *
+ * @param root The tree to search
+ * @param data The value to compare against
+ *
+ * @return unsigned int The number of values in the tree less than data
+ */
+unsigned int binary_tree_rank(struct node *root, int data)
+{
+    unsigned int rank = 0;
+
+    while (root) {
+        if (data <= root->data) {
+            root = root->left;
+        }
+        else {
+            rank += 1 + subtree_size(root->left);
+            root = root->right;
         }
     }
-    if (root->right) {
-        right_max = binary_tree_get_max(root->right);
-        if (right_max > max) {
-            max = right_max;
+
+    return rank;
+}
+
+/**
+ * @brief Get the value at a given position in the sorted order of a tree
+ *
+ * @param root The tree to search
+ * @param index The zero-based position to look up, so 0 selects the minimum
+ *
+ * @return int The value at the position, or INT_MAX if the index is out of bounds
+ */
+int binary_tree_select(struct node *root, unsigned int index)
+{
+    if (index >= subtree_size(root)) {
+        return INT_MAX;
+    }
+
+    while (root) {
+        unsigned int left_size = subtree_size(root->left);
+
+        if (index < left_size) {
+            root = root->left;
+        }
+        else if (index == left_size) {
+            return root->data;
+        }
+        else {
+            index -= left_size + 1;
+            root = root->right;
         }
     }
 
-    return max;
+    return INT_MAX;
 }
 
 /**
@@ -204,19 +400,95 @@ int binary_tree_get_max(struct node *root)
  */
 int binary_tree_is_in_tree(struct node *root, int data)
 {
-    if (!root) {
-        return 0;
+    while (root) {
+        if (root->data == data) {
+            return 1;
+        }
+        root = (root->data > data) ? root->left : root->right;
     }
 
-    if (root->data == data) {
-        return 1;
-    }
-    else if (root->data > data) {
-        return binary_tree_is_in_tree(root->left, data);
-    }
-    else {
-        return binary_tree_is_in_tree(root->right, data);
+    return 0;
+}
+
+/**
+ * @brief Check which values from a sorted batch are in a tree
+ *
+ * Rather than starting every search at the root, the walk keeps the path of nodes where the
+ * previous search turned left. The next, larger probe only climbs as far as the first of those
+ * nodes that is still above it, so a batch of m probes against n nodes costs close to O(n + m)
+ * and touches each node at most a few times. If the path cannot grow, it is dropped and the
+ * next probe starts again from the root, so running out of memory only costs speed.
+ *
+ * @param root The tree to search
+ * @param probes The values to search for, in ascending order. Repeats are allowed.
+ * @param count The number of probes
+ * @param hits A bitmap of at least (count + 7) / 8 bytes. Bit i % 8 of byte i / 8 is set if
+ * probes[i] is in the tree.
+ *
+ * @return unsigned int The number of probes found in the tree
+ */
+unsigned int binary_tree_is_in_tree_sorted(struct node *root, const int *probes,
+                                           unsigned int count, unsigned char *hits)
+{
+    struct binary_tree_iter path;
+    unsigned int found = 0;
+    int lost = 0;
+
+    memset(hits, 0, (count + 7) / 8);
+    binary_tree_iter_init(&path, NULL, BINARY_TREE_INORDER);
+
+    for (unsigned int i = 0; i < count; ++i) {
+        const int probe = probes[i];
+        struct node *current = root;
+
+        if (i > 0 && !lost) {
+            struct node *passed = NULL;
+
+            /* Climb back past every left turn whose node is now behind the probe */
+            while (path.depth > 0 && path.stack[path.depth - 1]->data < probe) {
+                passed = path.stack[--path.depth];
+            }
+
+            if (path.depth > 0 && path.stack[path.depth - 1]->data == probe) {
+                hits[i / 8] |= 1 << (i % 8);
+                ++found;
+                continue;
+            }
+
+            /*
+             * With nothing passed, the probe falls in the same empty gap that ended the previous
+             * search. Otherwise it can only be in the right subtree of the last node passed.
+             */
+            current = passed ? passed->right : NULL;
+        }
+        lost = 0;
+
+        while (current) {
+            if (probe < current->data) {
+                if (!lost && !iter_push(&path, current)) {
+                    /* A partial path would send later probes into the wrong subtree */
+                    path.depth = 0;
+                    lost = 1;
+                }
+                current = current->left;
+            }
+            else if (probe > current->data) {
+                current = current->right;
+            }
+            else {
+                if (!lost && !iter_push(&path, current)) {
+                    path.depth = 0;
+                    lost = 1;
+                }
+                hits[i / 8] |= 1 << (i % 8);
+                ++found;
+                break;
+            }
+        }
     }
+    binary_tree_iter_free(&path);
+
+    return found;
 }
 
 /**
@@ -226,34 +498,491 @@ int binary_tree_is_in_tree(struct node *root, int data)
  * @param min The minimum value to check the tree against
  * @param max The maximum value to check the tree against
  *
- * @return int 1 if the tree is a BST, 0 otherwise
+ * @return int 1 if the tree is a BST, 0 otherwise, or -1 if there was not enough memory to check
+ *         the whole tree
  */
 int binary_tree_is_bst(struct node *root, int min, int max)
 {
-    if (!root) {
-        return 1;
+    struct binary_tree_iter iter;
+    struct node *current;
+    int prev = min;
+    int is_bst = 1;
+
+    /* A tree is a BST exactly when its in-order walk is strictly increasing within (min, max) */
+    binary_tree_iter_init(&iter, root, BINARY_TREE_INORDER);
+    while ((current = binary_tree_iter_next(&iter))) {
+        if (current->data <= prev || current->data >= max) {
+            is_bst = 0;
+            break;
+        }
+        prev = current->data;
     }
-
-    if (root->data <= min || root->data >= max) {
-        return 0;
+    if (is_bst && binary_tree_iter_failed(&iter)) {
+        is_bst = -1;
     }
+    binary_tree_iter_free(&iter);
 
-    return binary_tree_is_bst(root->left, min, root->data) &&
-           binary_tree_is_bst(root->right, root->data, max);
+    return is_bst;
 }
 
 /**
  * @brief Print the values in a tree, from min to max
  *
+ * If there is not enough memory to walk the whole tree, printing stops early.
+ *
  * @param root The root node of the tree to print
  */
 void binary_tree_print(struct node *root)
 {
+    struct binary_tree_iter iter;
+    struct node *current;
+
+    binary_tree_iter_init(&iter, root, BINARY_TREE_INORDER);
+    while ((current = binary_tree_iter_next(&iter))) {
+        printf("%d ", current->data);
+    }
+    binary_tree_iter_free(&iter);
+}
+
+/**
+ * @brief Prepare an iterator for walking a tree
+ *
+ * @param iter The iterator to initialize
+ * @param root The root node of the tree to walk
+ * @param order The order in which nodes should be visited
+ */
+void binary_tree_iter_init(struct binary_tree_iter *iter, struct node *root,
+                           enum binary_tree_order order)
+{
+    iter->order = order;
+    iter->stack = NULL;
+    iter->depth = 0;
+    iter->capacity = 0;
+    iter->last = NULL;
+    iter->failed = 0;
+
     if (!root) {
         return;
     }
 
-    binary_tree_print(root->left);
-    printf("%d ", root->data);
-    binary_tree_print(root->right);
+    if (order == BINARY_TREE_PREORDER) {
+        iter_push(iter, root);
+    }
+    else {
+        iter_push_left_spine(iter, root);
+    }
+}
+
+/**
+ * @brief Prepare an in-order iterator that starts at the first value not less than a bound
+ *
+ * Only the path from the root to the starting node is pushed, so seeking costs O(height).
+ *
+ * @param iter The iterator to initialize
+ * @param root The root node of the tree to walk
+ * @param data The smallest value the walk should visit
+ */
+void binary_tree_iter_seek(struct binary_tree_iter *iter, struct node *root, int data)
+{
+    binary_tree_iter_init(iter, NULL, BINARY_TREE_INORDER);
+
+    /* Keep every node we pass on the left, since those come after the bound in order */
+    while (root) {
+        if (root->data >= data) {
+            if (!iter_push(iter, root)) {
+                return;
+            }
+            root = root->left;
+        }
+        else {
+            root = root->right;
+        }
+    }
+}
+
+/**
+ * @brief Advance an iterator to the next node
+ *
+ * @param iter The iterator to advance
+ *
+ * @return struct node* The next node in the walk, or NULL once every node has been visited or the
+ *         walk has failed. Use binary_tree_iter_failed to tell the two apart.
+ */
+struct node *binary_tree_iter_next(struct binary_tree_iter *iter)
+{
+    struct node *current;
+
+    if (iter->failed) {
+        return NULL;
+    }
+
+    switch (iter->order) {
+        case BINARY_TREE_PREORDER:
+            if (iter->depth == 0) {
+                return NULL;
+            }
+            current = iter->stack[--iter->depth];
+            if (current->right) {
+                iter_push(iter, current->right);
+            }
+            if (current->left) {
+                iter_push(iter, current->left);
+            }
+            return current;
+
+        case BINARY_TREE_INORDER:
+            if (iter->depth == 0) {
+                return NULL;
+            }
+            current = iter->stack[--iter->depth];
+            iter_push_left_spine(iter, current->right);
+            return current;
+
+        case BINARY_TREE_POSTORDER:
+            while (iter->depth > 0) {
+                current = iter->stack[iter->depth - 1];
+
+                /* Visit the right subtree first unless we have just come back up from it */
+                if (current->right && current->right != iter->last) {
+                    iter_push_left_spine(iter, current->right);
+                    if (iter->failed) {
+                        return NULL;
+                    }
+                    continue;
+                }
+
+                --iter->depth;
+                iter->last = current;
+                return current;
+            }
+            return NULL;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Check whether a walk ended early because the iterator ran out of memory
+ *
+ * @param iter The iterator to check
+ *
+ * @return int 1 if the stack could not grow and some nodes were never visited, or 0 otherwise
+ */
+int binary_tree_iter_failed(struct binary_tree_iter *iter)
+{
+    return iter->failed;
+}
+
+/**
+ * @brief Free memory used by an iterator
+ *
+ * @param iter The iterator to free memory from
+ */
+void binary_tree_iter_free(struct binary_tree_iter *iter)
+{
+    free(iter->stack);
+    iter->stack = NULL;
+    iter->depth = 0;
+    iter->capacity = 0;
+}
+
+/**
+ * @brief Create a new, empty binary tree that allocates its nodes from a pool
+ *
+ * @return struct binary_tree* A pointer to the new tree, or NULL if allocation fails
+ */
+struct binary_tree *binary_tree_new(void)
+{
+    struct binary_tree *tree = malloc(sizeof(*tree));
+    if (!tree) {
+        return NULL;
+    }
+
+    tree->root = NULL;
+    tree->slabs = NULL;
+    tree->free_list = NULL;
+
+    return tree;
+}
+
+/**
+ * @brief Free a pooled tree and all of its nodes at once
+ *
+ * @param tree The tree to free
+ */
+void binary_tree_destroy(struct binary_tree *tree)
+{
+    if (!tree) {
+        return;
+    }
+
+    struct node_slab *slab = tree->slabs;
+    while (slab) {
+        struct node_slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(tree);
+}
+
+/**
+ * @brief Make sure a pooled tree can hand out a number of nodes without calling malloc
+ *
+ * @param tree The tree to reserve nodes in
+ * @param count The number of nodes to reserve
+ *
+ * @return int 1 on success, or 0 if allocation fails
+ */
+int binary_tree_reserve(struct binary_tree *tree, unsigned int count)
+{
+    unsigned int available = tree->slabs ? tree->slabs->capacity - tree->slabs->used : 0;
+    if (available >= count) {
+        return 1;
+    }
+
+    unsigned int capacity = tree->slabs ? tree->slabs->capacity * 2 : NODE_SLAB_MIN_CAPACITY;
+    if (capacity > NODE_SLAB_MAX_CAPACITY) {
+        capacity = NODE_SLAB_MAX_CAPACITY;
+    }
+    if (capacity < count) {
+        capacity = count;
+    }
+
+    struct node_slab *slab = malloc(sizeof(*slab) + sizeof(struct node) * capacity);
+    if (!slab) {
+        return 0;
+    }
+    slab->capacity = capacity;
+    slab->used = 0;
+    slab->next = tree->slabs;
+    tree->slabs = slab;
+
+    return 1;
+}
+
+/**
+ * @brief Take a node from a tree's pool
+ *
+ * Recycled nodes are preferred. Otherwise the node is carved off the newest slab, which is
+ * only a pointer bump unless the slab is full.
+ *
+ * @param tree The tree that owns the pool
+ * @param data The data to save in the node
+ *
+ * @return struct node* The node, or NULL if allocation fails
+ */
+static struct node *pool_node_init(struct binary_tree *tree, int data)
+{
+    struct node *new_node = tree->free_list;
+
+    if (new_node) {
+        tree->free_list = new_node->right;
+    }
+    else {
+        if (!binary_tree_reserve(tree, 1)) {
+            return NULL;
+        }
+        new_node = &tree->slabs->nodes[tree->slabs->used++];
+    }
+
+    new_node->data = data;
+    new_node->size = 1;
+    new_node->left = NULL;
+    new_node->right = NULL;
+
+    return new_node;
+}
+
+/**
+ * @brief Insert a value into a pooled tree
+ *
+ * @param tree The tree to insert into
+ * @param data The value to add to the tree
+ *
+ * @return int 1 if the value was added, or 0 if it was already present or allocation failed
+ */
+int binary_tree_add(struct binary_tree *tree, int data)
+{
+    if (binary_tree_is_in_tree(tree->root, data)) {
+        return 0;
+    }
+
+    struct node *new_node = pool_node_init(tree, data);
+    if (!new_node) {
+        return 0;
+    }
+
+    if (!tree->root) {
+        tree->root = new_node;
+    }
+    else {
+        link_leaf(tree->root, new_node);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Link a run of sorted nodes into a perfectly balanced subtree
+ *
+ * @param nodes The nodes to link, already holding their values in ascending order
+ * @param count The number of nodes in the run
+ *
+ * @return struct node* The root of the subtree, or NULL if the run is empty
+ */
+static struct node *link_balanced(struct node *nodes, unsigned int count)
+{
+    if (count == 0) {
+        return NULL;
+    }
+
+    /* Recursion only goes log2(count) levels deep, so it is safe for any input size */
+    unsigned int mid = count / 2;
+    struct node *root = &nodes[mid];
+    root->size = count;
+    root->left = link_balanced(nodes, mid);
+    root->right = link_balanced(nodes + mid + 1, count - mid - 1);
+
+    return root;
+}
+
+/**
+ * @brief Build a balanced pooled tree from values that are already sorted
+ *
+ * All nodes are taken from a single slab and linked in O(n) time. Repeated values are stored
+ * once, matching the behavior of binary_tree_add.
+ *
+ * @param data The values to store, in ascending order
+ * @param count The number of values
+ *
+ * @return struct binary_tree* A pointer to the new tree, or NULL if allocation fails
+ */
+struct binary_tree *binary_tree_build_sorted(const int *data, unsigned int count)
+{
+    struct binary_tree *tree = binary_tree_new();
+    if (!tree) {
+        return NULL;
+    }
+    if (count == 0) {
+        return tree;
+    }
+
+    if (!binary_tree_reserve(tree, count)) {
+        binary_tree_destroy(tree);
+        return NULL;
+    }
+
+    struct node *nodes = &tree->slabs->nodes[tree->slabs->used];
+    unsigned int unique = 0;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        if (unique > 0 && nodes[unique - 1].data == data[i]) {
+            continue;
+        }
+        nodes[unique++].data = data[i];
+    }
+    tree->slabs->used += unique;
+    tree->root = link_balanced(nodes, unique);
+
+    return tree;
+}
+
+/**
+ * @brief Compare two integers for qsort
+ *
+ * @param a Pointer to the first integer
+ * @param b Pointer to the second integer
+ *
+ * @return int A negative value, zero or a positive value if a is less than, equal to or greater
+ * than b
+ */
+static int compare_ints(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Build a balanced pooled tree from values in any order
+ *
+ * @param data The values to store
+ * @param count The number of values
+ *
+ * @return struct binary_tree* A pointer to the new tree, or NULL if allocation fails
+ */
+struct binary_tree *binary_tree_build(const int *data, unsigned int count)
+{
+    int *sorted = malloc(sizeof(*sorted) * (count ? count : 1));
+    if (!sorted) {
+        return NULL;
+    }
+
+    for (unsigned int i = 0; i < count; ++i) {
+        sorted[i] = data[i];
+    }
+    qsort(sorted, count, sizeof(*sorted), compare_ints);
+
+    struct binary_tree *tree = binary_tree_build_sorted(sorted, count);
+    free(sorted);
+
+    return tree;
+}
+
+/**
+ * @brief Remove a value from a pooled tree, returning its node to the pool
+ *
+ * @param tree The tree to remove from
+ * @param data The value to remove
+ *
+ * @return int 1 if the value was removed, or 0 if it was not in the tree
+ */
+int binary_tree_remove(struct binary_tree *tree, int data)
+{
+    struct node *removed = unlink_value(&tree->root, data);
+    if (!removed) {
+        return 0;
+    }
+
+    removed->right = tree->free_list;
+    tree->free_list = removed;
+
+    return 1;
+}
+
+/**
+ * @brief Visit every value in a tree that falls within a closed range, in ascending order
+ *
+ * Subtrees that lie entirely outside the range are never entered, so the scan costs
+ * O(height + k) for k matching values.
+ *
+ * @param root The root node of the tree to scan
+ * @param low The smallest value to visit
+ * @param high The largest value to visit
+ * @param visit Function called with each value in the range and the caller's context
+ * @param context Pointer passed through to the visit function
+ *
+ * @return unsigned int The number of values visited, or UINT_MAX if there was not enough memory to
+ *         finish the scan. Some values may have been visited before it stopped.
+ */
+unsigned int binary_tree_range(struct node *root, int low, int high,
+                               void (*visit)(int data, void *context), void *context)
+{
+    struct binary_tree_iter iter;
+    struct node *current;
+    unsigned int visited = 0;
+
+    binary_tree_iter_seek(&iter, root, low);
+    while ((current = binary_tree_iter_next(&iter)) && current->data <= high) {
+        visit(current->data, context);
+        ++visited;
+    }
+    /* Stopping at a value past the bound means the whole range was seen, even if a push failed */
+    if (!current && binary_tree_iter_failed(&iter)) {
+        visited = UINT_MAX;
+    }
+    binary_tree_iter_free(&iter);
+
+    return visited;
 }
@@ -14,24 +14,68 @@
 
 struct node {
     int data;
+    unsigned int size; /** The number of nodes in the subtree rooted at this node. */
     struct node *left;
     struct node *right;
 };
 
+struct node_slab;
+
+struct binary_tree {
+    struct node *root;       /** The root node of the tree, or NULL if the tree is empty. */
+    struct node_slab *slabs; /** Blocks of nodes owned by the tree, newest first. */
+    struct node *free_list;  /** Released nodes ready for reuse, chained by their right pointers. */
+};
+
+enum binary_tree_order { BINARY_TREE_PREORDER, BINARY_TREE_INORDER, BINARY_TREE_POSTORDER };
+
+struct binary_tree_iter {
+    enum binary_tree_order order; /** The order in which nodes are visited. */
+    struct node **stack;          /** Nodes waiting to be visited or revisited. */
+    unsigned int depth;           /** The number of nodes on the stack. */
+    unsigned int capacity;        /** The number of nodes the stack can hold before growing. */
+    struct node *last;            /** The most recently visited node, used by post-order walks. */
+    int failed;                   /** Set if the stack could not grow, which ends the walk early. */
+};
+
 struct node *node_init(int data);
 void node_free(struct node *node);
 void binary_tree_free(struct node *root);
 
 struct node *binary_tree_insert(struct node *root, const int data);
+struct node *binary_tree_delete(struct node *root, const int data);
 
 unsigned int binary_tree_get_node_count(struct node *root);
 unsigned int binary_tree_get_height(struct node *root);
 int binary_tree_get_min(struct node *root);
 int binary_tree_get_max(struct node *root);
 
+unsigned int binary_tree_rank(struct node *root, int data);
+int binary_tree_select(struct node *root, unsigned int index);
+
 int binary_tree_is_in_tree(struct node *root, int data);
+unsigned int binary_tree_is_in_tree_sorted(struct node *root, const int *probes,
+                                           unsigned int count, unsigned char *hits);
 int binary_tree_is_bst(struct node *root, int min, int max);
 
 void binary_tree_print(struct node *root);
+unsigned int binary_tree_range(struct node *root, int low, int high,
+                               void (*visit)(int data, void *context), void *context);
+
+void binary_tree_iter_init(struct binary_tree_iter *iter, struct node *root,
+                           enum binary_tree_order order);
+void binary_tree_iter_seek(struct binary_tree_iter *iter, struct node *root, int data);
+struct node *binary_tree_iter_next(struct binary_tree_iter *iter);
+int binary_tree_iter_failed(struct binary_tree_iter *iter);
+void binary_tree_iter_free(struct binary_tree_iter *iter);
+
+struct binary_tree *binary_tree_new(void);
+void binary_tree_destroy(struct binary_tree *tree);
+int binary_tree_reserve(struct binary_tree *tree, unsigned int count);
+int binary_tree_add(struct binary_tree *tree, int data);
+int binary_tree_remove(struct binary_tree *tree, int data);
+
+struct binary_tree *binary_tree_build_sorted(const int *data, unsigned int count);
+struct binary_tree *binary_tree_build(const int *data, unsigned int count);
 
 #endif /* BINARY_TREE_H */
@@ -0,0 +1,221 @@
+/**
+ * @file compact_tree.c
+ * @author agent <agent@local>
+ * @brief A binary search tree that links its nodes with 32-bit array indices
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * Nodes live in one growable array and refer to their children by index, so a node takes 12
+ * bytes instead of the 32 that malloc hands out for a pointer-linked struct node. Indices stay
+ * valid when the array is reallocated, which lets the pool grow without fixing up any links.
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include "compact_tree.h"
+
+/** The number of slots allocated when no capacity is requested. */
+#define COMPACT_TREE_MIN_CAPACITY 16
+
+/**
+ * @brief Create a new compact tree
+ *
+ * @param capacity The number of values the tree should be able to hold before growing
+ *
+ * @return struct compact_tree* A pointer to the new tree, or NULL if allocation fails
+ */
+struct compact_tree *compact_tree_new(uint32_t capacity)
+{
+    struct compact_tree *tree = malloc(sizeof(*tree));
+    if (!tree) {
+        return NULL;
+    }
+
+    /* Reserve one extra slot for the nil index */
+    if (capacity < COMPACT_TREE_MIN_CAPACITY) {
+        capacity = COMPACT_TREE_MIN_CAPACITY;
+    }
+    if (capacity < UINT32_MAX) {
+        ++capacity;
+    }
+
+    tree->nodes = malloc(sizeof(*tree->nodes) * capacity);
+    if (!tree->nodes) {
+        free(tree);
+        return NULL;
+    }
+    tree->root = COMPACT_TREE_NIL;
+    tree->count = 0;
+    tree->capacity = capacity;
+
+    return tree;
+}
+
+/**
+ * @brief Free memory used by a compact tree
+ *
+ * @param tree The tree to free
+ */
+void compact_tree_free(struct compact_tree *tree)
+{
+    if (!tree) {
+        return;
+    }
+
+    free(tree->nodes);
+    free(tree);
+}
+
+/**
+ * @brief Double the size of a compact tree's node array
+ *
+ * @param tree The tree to grow
+ *
+ * @return int 1 on success, or 0 if the tree cannot grow any further
+ */
+static int compact_tree_grow(struct compact_tree *tree)
+{
+    if (tree->capacity == UINT32_MAX) {
+        return 0;
+    }
+
+    uint32_t capacity = (tree->capacity > UINT32_MAX / 2) ? UINT32_MAX : tree->capacity * 2;
+    struct compact_node *nodes = realloc(tree->nodes, sizeof(*nodes) * capacity);
+    if (!nodes) {
+        return 0;
+    }
+    tree->nodes = nodes;
+    tree->capacity = capacity;
+
+    return 1;
+}
+
+/**
+ * @brief Insert a value into a compact tree
+ *
+ * @param tree The tree to insert into
+ * @param data The value to add to the tree
+ *
+ * @return int 1 if the value was added, or 0 if it was already present or the tree is full
+ */
+int compact_tree_insert(struct compact_tree *tree, int data)
+{
+    uint32_t parent = COMPACT_TREE_NIL;
+    uint32_t index = tree->root;
+    int go_left = 0;
+
+    while (index != COMPACT_TREE_NIL) {
+        const struct compact_node *current = &tree->nodes[index];
+
+        if (data == current->data) {
+            return 0;
+        }
+        parent = index;
+        go_left = data < current->data;
+        index = go_left ? current->left : current->right;
+    }
+
+    if (tree->count + 1 == tree->capacity && !compact_tree_grow(tree)) {
+        return 0;
+    }
+
+    index = ++tree->count;
+    tree->nodes[index].data = data;
+    tree->nodes[index].left = COMPACT_TREE_NIL;
+    tree->nodes[index].right = COMPACT_TREE_NIL;
+
+    if (parent == COMPACT_TREE_NIL) {
+        tree->root = index;
+    }
+    else if (go_left) {
+        tree->nodes[parent].left = index;
+    }
+    else {
+        tree->nodes[parent].right = index;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Check if a value is in a compact tree
+ *
+ * @param tree The tree to search
+ * @param data The value to search for
+ *
+ * @return int 1 if the value is found, or 0 otherwise
+ */
+int compact_tree_is_in_tree(struct compact_tree *tree, int data)
+{
+    uint32_t index = tree->root;
+
+    while (index != COMPACT_TREE_NIL) {
+        const struct compact_node *current = &tree->nodes[index];
+
+        if (data == current->data) {
+            return 1;
+        }
+        index = (data < current->data) ? current->left : current->right;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Count the number of nodes in a compact tree
+ *
+ * @param tree The tree to count
+ *
+ * @return unsigned int The number of nodes in the tree
+ */
+unsigned int compact_tree_get_node_count(struct compact_tree *tree)
+{
+    return tree->count;
+}
+
+/**
+ * @brief Get the minimum value in a compact tree
+ *
+ * @param tree The tree to search
+ *
+ * @return int The minimum value in the tree, or INT_MAX if the tree is empty
+ */
+int compact_tree_get_min(struct compact_tree *tree)
+{
+    uint32_t index = tree->root;
+
+    if (index == COMPACT_TREE_NIL) {
+        return INT_MAX;
+    }
+
+    while (tree->nodes[index].left != COMPACT_TREE_NIL) {
+        index = tree->nodes[index].left;
+    }
+
+    return tree->nodes[index].data;
+}
+
+/**
+ * @brief Get the maximum value in a compact tree
+ *
+ * @param tree The tree to search
+ *
+ * @return int The maximum value in the tree, or INT_MAX if the tree is empty
+ */
+int compact_tree_get_max(struct compact_tree *tree)
+{
+    uint32_t index = tree->root;
+
+    if (index == COMPACT_TREE_NIL) {
+        return INT_MAX;
+    }
+
+    while (tree->nodes[index].right != COMPACT_TREE_NIL) {
+        index = tree->nodes[index].right;
+    }
+
+    return tree->nodes[index].data;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file compact_tree.h
+ * @author agent <agent@local>
+ * @brief A binary search tree that links its nodes with 32-bit array indices
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef COMPACT_TREE_H
+#define COMPACT_TREE_H
+
+#include <stdint.h>
+
+/** The index used in place of a NULL child. Slot 0 of the node array is never used. */
+#define COMPACT_TREE_NIL 0
+
+struct compact_node {
+    int data;       /** The value stored in the node. */
+    uint32_t left;  /** Index of the left child, or COMPACT_TREE_NIL. */
+    uint32_t right; /** Index of the right child, or COMPACT_TREE_NIL. */
+};
+
+struct compact_tree {
+    struct compact_node *nodes; /** Every node in the tree, addressed by index. */
+    uint32_t root;              /** Index of the root node, or COMPACT_TREE_NIL if empty. */
+    uint32_t count;             /** The number of nodes in the tree. */
+    uint32_t capacity;          /** The number of slots in the node array, including slot 0. */
+};
+
+/** Create a new compact tree. */
+struct compact_tree *compact_tree_new(uint32_t capacity);
+/** Free memory used by a compact tree. */
+void compact_tree_free(struct compact_tree *tree);
+
+/** Insert a value into a compact tree. */
+int compact_tree_insert(struct compact_tree *tree, int data);
+/** Check if a value is in a compact tree. */
+int compact_tree_is_in_tree(struct compact_tree *tree, int data);
+
+/** Count the number of nodes in a compact tree. */
+unsigned int compact_tree_get_node_count(struct compact_tree *tree);
+/** Get the minimum value in a compact tree. */
+int compact_tree_get_min(struct compact_tree *tree);
+/** Get the maximum value in a compact tree. */
+int compact_tree_get_max(struct compact_tree *tree);
+
+#endif /* COMPACT_TREE_H */
@@ -0,0 +1,317 @@
+/**
+ * @file concurrent_tree.c
+ * @author agent <agent@local>
+ * @brief A binary search tree that readers can search without taking a lock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * Writers take a mutex. Readers never block and never write to shared memory, so lookups scale
+ * with the number of cores.
+ *
+ * An insert fully initializes its node before publishing it with a release store, so readers
+ * either see the finished node or do not see it at all. A delete may move a value from one node
+ * to another, which could make a reader miss a value that is present. Deletes therefore bump the
+ * tree's version before and after they run, and a reader that saw the version change retries.
+ *
+ * Deleted nodes are recycled but never returned to the system while the tree exists. A reader
+ * that is still holding one only ever sees valid, if stale, memory and fails its version check.
+ */
+
+#include <stdlib.h>
+
+#include "concurrent_tree.h"
+
+/** The number of nodes in the first slab. Later slabs double in size. */
+#define CONCURRENT_SLAB_MIN_CAPACITY 64
+
+/** The largest slab the tree will allocate, in nodes. */
+#define CONCURRENT_SLAB_MAX_CAPACITY 65536
+
+/** How many nodes a reader visits between checks for a delete that invalidated its walk. */
+#define CONCURRENT_TREE_RECHECK_STEPS 64
+
+struct concurrent_slab {
+    struct concurrent_slab *next; /** The previously allocated slab. */
+    unsigned int capacity;        /** The number of nodes in this slab. */
+    unsigned int used;            /** The number of nodes handed out from this slab so far. */
+    struct concurrent_node nodes[];
+};
+
+/**
+ * @brief Create a new concurrent tree
+ *
+ * @return struct concurrent_tree* A pointer to the new tree, or NULL if allocation fails
+ */
+struct concurrent_tree *concurrent_tree_new(void)
+{
+    struct concurrent_tree *tree = malloc(sizeof(*tree));
+    if (!tree) {
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&tree->lock, NULL) != 0) {
+        free(tree);
+        return NULL;
+    }
+    atomic_init(&tree->root, NULL);
+    atomic_init(&tree->version, 0);
+    atomic_init(&tree->size, 0);
+    tree->slabs = NULL;
+    tree->free_list = NULL;
+
+    return tree;
+}
+
+/**
+ * @brief Free memory used by a concurrent tree
+ *
+ * No other thread may be using the tree.
+ *
+ * @param tree The tree to free
+ */
+void concurrent_tree_free(struct concurrent_tree *tree)
+{
+    if (!tree) {
+        return;
+    }
+
+    struct concurrent_slab *slab = tree->slabs;
+    while (slab) {
+        struct concurrent_slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    pthread_mutex_destroy(&tree->lock);
+    free(tree);
+}
+
+/**
+ * @brief Take a node from the tree's pool. The caller must hold the writer lock.
+ *
+ * @param tree The tree that owns the pool
+ *
+ * @return struct concurrent_node* The node, or NULL if allocation fails
+ */
+static struct concurrent_node *node_alloc(struct concurrent_tree *tree)
+{
+    struct concurrent_node *node = tree->free_list;
+
+    if (node) {
+        tree->free_list = atomic_load_explicit(&node->right, memory_order_relaxed);
+        return node;
+    }
+
+    if (!tree->slabs || tree->slabs->used == tree->slabs->capacity) {
+        unsigned int capacity =
+            tree->slabs ? tree->slabs->capacity * 2 : CONCURRENT_SLAB_MIN_CAPACITY;
+        if (capacity > CONCURRENT_SLAB_MAX_CAPACITY) {
+            capacity = CONCURRENT_SLAB_MAX_CAPACITY;
+        }
+
+        struct concurrent_slab *slab =
+            malloc(sizeof(*slab) + sizeof(struct concurrent_node) * capacity);
+        if (!slab) {
+            return NULL;
+        }
+        slab->capacity = capacity;
+        slab->used = 0;
+        slab->next = tree->slabs;
+        tree->slabs = slab;
+    }
+
+    return &tree->slabs->nodes[tree->slabs->used++];
+}
+
+/**
+ * @brief Insert a value into a concurrent tree. The caller must hold the writer lock.
+ *
+ * @param tree The tree to insert into
+ * @param data The value to add to the tree
+ *
+ * @return int 1 if the value was added, or 0 if it was already present or allocation failed
+ */
+static int insert_locked(struct concurrent_tree *tree, int data)
+{
+    /* Only writers change links, so plain relaxed loads are enough while holding the lock */
+    _Atomic(struct concurrent_node *) *link = &tree->root;
+    struct concurrent_node *current;
+
+    while ((current = atomic_load_explicit(link, memory_order_relaxed))) {
+        int value = atomic_load_explicit(&current->data, memory_order_relaxed);
+        if (value == data) {
+            return 0;
+        }
+        link = (data < value) ? &current->left : &current->right;
+    }
+
+    struct concurrent_node *new_node = node_alloc(tree);
+    if (!new_node) {
+        return 0;
+    }
+    atomic_store_explicit(&new_node->data, data, memory_order_relaxed);
+    atomic_store_explicit(&new_node->left, NULL, memory_order_relaxed);
+    atomic_store_explicit(&new_node->right, NULL, memory_order_relaxed);
+
+    /* Publish the node only once it is fully initialized */
+    atomic_store_explicit(link, new_node, memory_order_release);
+    atomic_fetch_add_explicit(&tree->size, 1, memory_order_relaxed);
+
+    return 1;
+}
+
+/**
+ * @brief Insert a value into a concurrent tree
+ *
+ * @param tree The tree to insert into
+ * @param data The value to add to the tree
+ *
+ * @return int 1 if the value was added, or 0 if it was already present or allocation failed
+ */
+int concurrent_tree_insert(struct concurrent_tree *tree, int data)
+{
+    pthread_mutex_lock(&tree->lock);
+    int inserted = insert_locked(tree, data);
+    pthread_mutex_unlock(&tree->lock);
+
+    return inserted;
+}
+
+/**
+ * @brief Remove a value from a concurrent tree. The caller must hold the writer lock.
+ *
+ * @param tree The tree to remove from
+ * @param data The value to remove
+ *
+ * @return int 1 if the value was removed, or 0 if it was not in the tree
+ */
+static int delete_locked(struct concurrent_tree *tree, int data)
+{
+    _Atomic(struct concurrent_node *) *link = &tree->root;
+    struct concurrent_node *target;
+
+    while ((target = atomic_load_explicit(link, memory_order_relaxed))) {
+        int value = atomic_load_explicit(&target->data, memory_order_relaxed);
+        if (value == data) {
+            break;
+        }
+        link = (data < value) ? &target->left : &target->right;
+    }
+    if (!target) {
+        return 0;
+    }
+
+    /* An odd version tells readers that the tree is being restructured */
+    unsigned int version = atomic_load_explicit(&tree->version, memory_order_relaxed);
+    atomic_store_explicit(&tree->version, version + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    struct concurrent_node *left = atomic_load_explicit(&target->left, memory_order_relaxed);
+    struct concurrent_node *right = atomic_load_explicit(&target->right, memory_order_relaxed);
+    struct concurrent_node *removed = target;
+
+    if (!left) {
+        atomic_store_explicit(link, right, memory_order_release);
+    }
+    else if (!right) {
+        atomic_store_explicit(link, left, memory_order_release);
+    }
+    else {
+        /* Move the in-order successor's value up and unlink the successor instead */
+        link = &target->right;
+        while ((removed = atomic_load_explicit(link, memory_order_relaxed)) &&
+               atomic_load_explicit(&removed->left, memory_order_relaxed)) {
+            link = &removed->left;
+        }
+        atomic_store_explicit(&target->data,
+                              atomic_load_explicit(&removed->data, memory_order_relaxed),
+                              memory_order_relaxed);
+        atomic_store_explicit(link, atomic_load_explicit(&removed->right, memory_order_relaxed),
+                              memory_order_release);
+    }
+
+    atomic_store_explicit(&removed->right, tree->free_list, memory_order_relaxed);
+    tree->free_list = removed;
+
+    atomic_store_explicit(&tree->version, version + 2, memory_order_release);
+    atomic_fetch_sub_explicit(&tree->size, 1, memory_order_relaxed);
+
+    return 1;
+}
+
+/**
+ * @brief Remove a value from a concurrent tree
+ *
+ * @param tree The tree to remove from
+ * @param data The value to remove
+ *
+ * @return int 1 if the value was removed, or 0 if it was not in the tree
+ */
+int concurrent_tree_delete(struct concurrent_tree *tree, int data)
+{
+    pthread_mutex_lock(&tree->lock);
+    int deleted = delete_locked(tree, data);
+    pthread_mutex_unlock(&tree->lock);
+
+    return deleted;
+}
+
+/**
+ * @brief Check if a value is in a concurrent tree without locking
+ *
+ * The search is optimistic. It is retried if a delete ran while it was in progress.
+ *
+ * @param tree The tree to search
+ * @param data The value to search for
+ *
+ * @return int 1 if the value is found, or 0 otherwise
+ */
+int concurrent_tree_is_in_tree(struct concurrent_tree *tree, int data)
+{
+    for (;;) {
+        unsigned int version = atomic_load_explicit(&tree->version, memory_order_acquire);
+        if (version & 1) {
+            continue;
+        }
+
+        struct concurrent_node *current = atomic_load_explicit(&tree->root, memory_order_acquire);
+        unsigned int steps = 0;
+        int found = 0;
+        int stale = 0;
+
+        while (current) {
+            int value = atomic_load_explicit(&current->data, memory_order_relaxed);
+            if (value == data) {
+                found = 1;
+                break;
+            }
+            current = atomic_load_explicit((data < value) ? &current->left : &current->right,
+                                           memory_order_acquire);
+
+            /* A walk through recycled nodes could go on for a long time, so give up early */
+            if (++steps % CONCURRENT_TREE_RECHECK_STEPS == 0 &&
+                atomic_load_explicit(&tree->version, memory_order_relaxed) != version) {
+                stale = 1;
+                break;
+            }
+        }
+
+        atomic_thread_fence(memory_order_acquire);
+        if (!stale && atomic_load_explicit(&tree->version, memory_order_relaxed) == version) {
+            return found;
+        }
+    }
+}
+
+/**
+ * @brief Get the number of values in a concurrent tree
+ *
+ * @param tree The tree to count
+ *
+ * @return unsigned int The number of values in the tree
+ */
+unsigned int concurrent_tree_get_size(struct concurrent_tree *tree)
+{
+    return atomic_load_explicit(&tree->size, memory_order_relaxed);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file concurrent_tree.h
+ * @author agent <agent@local>
+ * @brief A binary search tree that readers can search without taking a lock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef CONCURRENT_TREE_H
+#define CONCURRENT_TREE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+struct concurrent_node {
+    atomic_int data;                          /** The value stored in the node. */
+    _Atomic(struct concurrent_node *) left;   /** The left child, or NULL. */
+    _Atomic(struct concurrent_node *) right;  /** The right child, or NULL. */
+};
+
+struct concurrent_slab;
+
+struct concurrent_tree {
+    _Atomic(struct concurrent_node *) root;   /** The root node, or NULL if the tree is empty. */
+    atomic_uint version;                      /** Bumped around deletes, odd while one is running. */
+    atomic_uint size;                         /** The number of values in the tree. */
+    pthread_mutex_t lock;                     /** Serializes writers. Readers never take it. */
+    struct concurrent_slab *slabs;            /** Blocks of nodes owned by the tree. */
+    struct concurrent_node *free_list;        /** Deleted nodes ready for reuse. */
+};
+
+/** Create a new concurrent tree. */
+struct concurrent_tree *concurrent_tree_new(void);
+/** Free memory used by a concurrent tree. */
+void concurrent_tree_free(struct concurrent_tree *tree);
+
+/** Insert a value into a concurrent tree. */
+int concurrent_tree_insert(struct concurrent_tree *tree, int data);
+/** Remove a value from a concurrent tree. */
+int concurrent_tree_delete(struct concurrent_tree *tree, int data);
+
+/** Check if a value is in a concurrent tree without locking. */
+int concurrent_tree_is_in_tree(struct concurrent_tree *tree, int data);
+/** Get the number of values in a concurrent tree. */
+unsigned int concurrent_tree_get_size(struct concurrent_tree *tree);
+
+#endif /* CONCURRENT_TREE_H */
@@ -0,0 +1,131 @@
+/**
+ * @file typed_tree.h
+ * @author agent <agent@local>
+ * @brief Binary search trees specialized at compile time for any key type
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * TYPED_TREE_DEFINE(name, key_type, less) generates a node type and a set of functions for one
+ * key type. The comparison is a macro or inline function expanded into every generated
+ * function, so there is no call through a function pointer and a tree of int64_t or double
+ * keys searches as fast as the int tree in binary_tree.h. For example:
+ *
+ *     #define POINT_LESS(a, b) ((a).x < (b).x || ((a).x == (b).x && (a).y < (b).y))
+ *     TYPED_TREE_DEFINE(point_tree, struct point, POINT_LESS)
+ *
+ * defines struct point_tree_node, point_tree_insert(), point_tree_is_in_tree() and so on.
+ * Two keys are equal when neither is less than the other.
+ */
+
+#ifndef TYPED_TREE_H
+#define TYPED_TREE_H
+
+#include <stdlib.h>
+
+/** Order keys with the built-in < operator. Works for any arithmetic key type. */
+#define TYPED_TREE_LESS(a, b) ((a) < (b))
+
+#define TYPED_TREE_DEFINE(name, key_type, less)                                                   \
+    struct name##_node {                                                                          \
+        key_type key;                                                                             \
+        struct name##_node *left;                                                                 \
+        struct name##_node *right;                                                                \
+    };                                                                                            \
+                                                                                                  \
+    /** Create a new tree node. */                                                                \
+    static inline struct name##_node *name##_node_init(key_type key)                              \
+    {                                                                                             \
+        struct name##_node *new_node = malloc(sizeof(*new_node));                                 \
+        if (!new_node) {                                                                          \
+            return NULL;                                                                          \
+        }                                                                                         \
+        new_node->key = key;                                                                      \
+        new_node->left = NULL;                                                                    \
+        new_node->right = NULL;                                                                   \
+        return new_node;                                                                          \
+    }                                                                                             \
+                                                                                                  \
+    /** Free all memory used by a tree, without recursion. */                                     \
+    static inline void name##_free(struct name##_node *root)                                      \
+    {                                                                                             \
+        while (root) {                                                                            \
+            if (root->left) {                                                                     \
+                struct name##_node *left = root->left;                                            \
+                root->left = left->right;                                                         \
+                left->right = root;                                                               \
+                root = left;                                                                      \
+            }                                                                                     \
+            else {                                                                                \
+                struct name##_node *right = root->right;                                          \
+                free(root);                                                                       \
+                root = right;                                                                     \
+            }                                                                                     \
+        }                                                                                         \
+    }                                                                                             \
+                                                                                                  \
+    /**                                                                                           \
+     * Insert a key into a tree, updating *root if the tree was empty. Returns 1 if the key was   \
+     * added, 0 if it was already in the tree, or -1 if allocating its node failed.               \
+     */                                                                                           \
+    static inline int name##_insert(struct name##_node **root, key_type key)                      \
+    {                                                                                             \
+        struct name##_node **link = root;                                                         \
+        while (*link) {                                                                           \
+            if (less(key, (*link)->key)) {                                                        \
+                link = &(*link)->left;                                                            \
+            }                                                                                     \
+            else if (less((*link)->key, key)) {                                                   \
+                link = &(*link)->right;                                                           \
+            }                                                                                     \
+            else {                                                                                \
+                return 0;                                                                         \
+            }                                                                                     \
+        }                                                                                         \
+        *link = name##_node_init(key);                                                            \
+        return *link ? 1 : -1;                                                                    \
+    }                                                                                             \
+                                                                                                  \
+    /** Find the node holding a key, or NULL if the key is not in the tree. */                    \
+    static inline struct name##_node *name##_find(struct name##_node *root, key_type key)         \
+    {                                                                                             \
+        while (root) {                                                                            \
+            if (less(key, root->key)) {                                                           \
+                root = root->left;                                                                \
+            }                                                                                     \
+            else if (less(root->key, key)) {                                                      \
+                root = root->right;                                                               \
+            }                                                                                     \
+            else {                                                                                \
+                return root;                                                                      \
+            }                                                                                     \
+        }                                                                                         \
+        return NULL;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    /** Check if a key is in a tree. */                                                           \
+    static inline int name##_is_in_tree(struct name##_node *root, key_type key)                   \
+    {                                                                                             \
+        return name##_find(root, key) != NULL;                                                    \
+    }                                                                                             \
+                                                                                                  \
+    /** Get the node holding the smallest key, or NULL if the tree is empty. */                   \
+    static inline struct name##_node *name##_get_min(struct name##_node *root)                    \
+    {                                                                                             \
+        while (root && root->left) {                                                              \
+            root = root->left;                                                                    \
+        }                                                                                         \
+        return root;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    /** Get the node holding the largest key, or NULL if the tree is empty. */                    \
+    static inline struct name##_node *name##_get_max(struct name##_node *root)                    \
+    {                                                                                             \
+        while (root && root->right) {                                                             \
+            root = root->right;                                                                   \
+        }                                                                                         \
+        return root;                                                                              \
+    }
+
+#endif /* TYPED_TREE_H */
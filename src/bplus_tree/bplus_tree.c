@@ -0,0 +1,521 @@
+/**
+ * @file bplus_tree.c
+ * @author agent <agent@local>
+ * @brief An in-memory B+ tree of integers with cache-line-sized nodes
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "bplus_tree.h"
+
+/** Nodes are aligned to cache lines so that a node never straddles more lines than it fills. */
+#define CACHE_LINE_SIZE 64
+
+_Static_assert(sizeof(struct bplus_leaf) % CACHE_LINE_SIZE == 0,
+               "leaves must fill whole cache lines");
+_Static_assert(sizeof(struct bplus_inner) % CACHE_LINE_SIZE == 0,
+               "inner nodes must fill whole cache lines");
+
+/** An upper bound on the height of any tree that fits in memory. */
+#define BPLUS_TREE_MAX_HEIGHT 32
+
+/**
+ * @brief Count how many keys in a node are smaller than a value
+ *
+ * Every slot is compared, including unused ones, which hold INT_MAX and so never count. With
+ * SSE2 the keys are compared four at a time.
+ *
+ * @param keys The key slots of a node
+ * @param slots The number of key slots in the node
+ * @param data The value to compare against
+ *
+ * @return unsigned int The number of keys less than data, which is also the position at which
+ * data belongs in the node
+ */
+static unsigned int count_less(const int *keys, unsigned int slots, int data)
+{
+    unsigned int count = 0;
+    unsigned int i = 0;
+
+#ifdef __SSE2__
+    /* Each lane of a comparison result is -1 where true, so subtracting it counts matches */
+    __m128i needle = _mm_set1_epi32(data);
+    __m128i counts = _mm_setzero_si128();
+    int lanes[4];
+
+    for (; i + 4 <= slots; i += 4) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(keys + i));
+        counts = _mm_sub_epi32(counts, _mm_cmplt_epi32(chunk, needle));
+    }
+    _mm_storeu_si128((__m128i *)lanes, counts);
+    count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+    for (; i < slots; ++i) {
+        count += keys[i] < data;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Pick the child of an inner node whose subtree may hold a value
+ *
+ * @param inner The node to search
+ * @param data The value to look for
+ *
+ * @return unsigned int The index of the child to descend into
+ */
+static unsigned int child_index(const struct bplus_inner *inner, int data)
+{
+    unsigned int index = count_less(inner->keys, BPLUS_TREE_INNER_KEYS, data);
+
+    /* A separator equal to the value means the value lives in the subtree to its right */
+    if (index < inner->count && inner->keys[index] == data) {
+        ++index;
+    }
+
+    return index;
+}
+
+/**
+ * @brief Allocate a cache-line-aligned node
+ *
+ * @param size The size of the node in bytes, which must be a multiple of CACHE_LINE_SIZE
+ *
+ * @return void* The node, or NULL if allocation fails
+ */
+static void *node_alloc(size_t size)
+{
+    return aligned_alloc(CACHE_LINE_SIZE, size);
+}
+
+/**
+ * @brief Create a new, empty leaf
+ *
+ * @return struct bplus_leaf* The new leaf, or NULL if allocation fails
+ */
+static struct bplus_leaf *leaf_init(void)
+{
+    struct bplus_leaf *leaf = node_alloc(sizeof(*leaf));
+    if (!leaf) {
+        return NULL;
+    }
+
+    leaf->count = 0;
+    for (int i = 0; i < BPLUS_TREE_LEAF_KEYS; ++i) {
+        leaf->keys[i] = INT_MAX;
+    }
+    leaf->next = NULL;
+
+    return leaf;
+}
+
+/**
+ * @brief Create a new, empty inner node
+ *
+ * @return struct bplus_inner* The new node, or NULL if allocation fails
+ */
+static struct bplus_inner *inner_init(void)
+{
+    struct bplus_inner *inner = node_alloc(sizeof(*inner));
+    if (!inner) {
+        return NULL;
+    }
+
+    inner->count = 0;
+    for (int i = 0; i < BPLUS_TREE_INNER_KEYS; ++i) {
+        inner->keys[i] = INT_MAX;
+    }
+    for (int i = 0; i <= BPLUS_TREE_INNER_KEYS; ++i) {
+        inner->children[i] = NULL;
+    }
+
+    return inner;
+}
+
+/**
+ * @brief Create a new B+ tree
+ *
+ * @return struct bplus_tree* A pointer to the new tree, or NULL if allocation fails
+ */
+struct bplus_tree *bplus_tree_new(void)
+{
+    struct bplus_tree *tree = malloc(sizeof(*tree));
+    if (!tree) {
+        return NULL;
+    }
+
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->height = 0;
+    tree->size = 0;
+
+    return tree;
+}
+
+/**
+ * @brief Free a subtree of inner nodes
+ *
+ * Leaves are freed separately by following the leaf chain.
+ *
+ * @param node The root of the subtree
+ * @param height The number of levels in the subtree, counting the leaves
+ */
+static void inner_free(void *node, unsigned int height)
+{
+    if (height <= 1) {
+        return;
+    }
+
+    struct bplus_inner *inner = node;
+    for (unsigned int i = 0; i <= inner->count; ++i) {
+        inner_free(inner->children[i], height - 1);
+    }
+    free(inner);
+}
+
+/**
+ * @brief Free memory used by a B+ tree
+ *
+ * @param tree The tree to free
+ */
+void bplus_tree_free(struct bplus_tree *tree)
+{
+    if (!tree) {
+        return;
+    }
+
+    inner_free(tree->root, tree->height);
+
+    struct bplus_leaf *leaf = tree->first;
+    while (leaf) {
+        struct bplus_leaf *next = leaf->next;
+        free(leaf);
+        leaf = next;
+    }
+    free(tree);
+}
+
+/**
+ * @brief Find the leaf whose key range covers a value
+ *
+ * @param tree The tree to search, which must not be empty
+ * @param data The value to look for
+ *
+ * @return struct bplus_leaf* The leaf that holds, or would hold, the value
+ */
+static struct bplus_leaf *find_leaf(struct bplus_tree *tree, int data)
+{
+    void *node = tree->root;
+
+    for (unsigned int level = tree->height; level > 1; --level) {
+        struct bplus_inner *inner = node;
+        node = inner->children[child_index(inner, data)];
+    }
+
+    return node;
+}
+
+/**
+ * @brief Insert a separator and the child to its right into an inner node with room to spare
+ *
+ * @param inner The node to insert into
+ * @param index The position of the new separator
+ * @param key The separator key
+ * @param child The child holding keys greater than or equal to the separator
+ */
+static void inner_insert_at(struct bplus_inner *inner, unsigned int index, int key, void *child)
+{
+    memmove(&inner->keys[index + 1], &inner->keys[index],
+            sizeof(inner->keys[0]) * (inner->count - index));
+    memmove(&inner->children[index + 2], &inner->children[index + 1],
+            sizeof(inner->children[0]) * (inner->count - index));
+    inner->keys[index] = key;
+    inner->children[index + 1] = child;
+    ++inner->count;
+}
+
+/**
+ * @brief Insert a value into a B+ tree
+ *
+ * @param tree The tree to insert into
+ * @param data The value to add to the tree
+ *
+ * @return int 1 if the value was added, or 0 if it was already present or allocation failed
+ */
+int bplus_tree_insert(struct bplus_tree *tree, int data)
+{
+    struct bplus_inner *path[BPLUS_TREE_MAX_HEIGHT];
+    unsigned int path_index[BPLUS_TREE_MAX_HEIGHT];
+    unsigned int depth = 0;
+
+    if (!tree->root) {
+        struct bplus_leaf *leaf = leaf_init();
+        if (!leaf) {
+            return 0;
+        }
+        tree->root = leaf;
+        tree->first = leaf;
+        tree->height = 1;
+    }
+
+    /* Remember the way down so that splits can be pushed back up without parent pointers */
+    void *node = tree->root;
+    for (unsigned int level = tree->height; level > 1; --level) {
+        struct bplus_inner *inner = node;
+        unsigned int index = child_index(inner, data);
+
+        path[depth] = inner;
+        path_index[depth] = index;
+        ++depth;
+        node = inner->children[index];
+    }
+
+    struct bplus_leaf *leaf = node;
+    unsigned int pos = count_less(leaf->keys, BPLUS_TREE_LEAF_KEYS, data);
+    if (pos < leaf->count && leaf->keys[pos] == data) {
+        return 0;
+    }
+
+    if (leaf->count < BPLUS_TREE_LEAF_KEYS) {
+        memmove(&leaf->keys[pos + 1], &leaf->keys[pos], sizeof(leaf->keys[0]) * (leaf->count - pos));
+        leaf->keys[pos] = data;
+        ++leaf->count;
+        ++tree->size;
+        return 1;
+    }
+
+    /* The leaf is full. Every full ancestor above it will split too, and if they all do, the
+     * root grows. Allocate every node the splits need before changing anything, so that running
+     * out of memory leaves the tree as it was. */
+    unsigned int splits = 0;
+    while (splits < depth && path[depth - 1 - splits]->count == BPLUS_TREE_INNER_KEYS) {
+        ++splits;
+    }
+    int grows = (splits == depth);
+
+    struct bplus_inner *siblings[BPLUS_TREE_MAX_HEIGHT];
+    struct bplus_inner *root = NULL;
+    struct bplus_leaf *right = leaf_init();
+    unsigned int allocated = 0;
+
+    if (right) {
+        while (allocated < splits && (siblings[allocated] = inner_init())) {
+            ++allocated;
+        }
+        if (allocated == splits && grows) {
+            root = inner_init();
+        }
+    }
+    if (!right || allocated < splits || (grows && !root)) {
+        for (unsigned int i = 0; i < allocated; ++i) {
+            free(siblings[i]);
+        }
+        free(right);
+        return 0;
+    }
+
+    /* Split the leaf in half, then insert the value into the proper half */
+
+    unsigned int keep = (BPLUS_TREE_LEAF_KEYS + 1) / 2;
+    unsigned int moved = BPLUS_TREE_LEAF_KEYS - keep;
+    memcpy(right->keys, &leaf->keys[keep], sizeof(leaf->keys[0]) * moved);
+    for (unsigned int i = keep; i < BPLUS_TREE_LEAF_KEYS; ++i) {
+        leaf->keys[i] = INT_MAX;
+    }
+    leaf->count = keep;
+    right->count = moved;
+    right->next = leaf->next;
+    leaf->next = right;
+
+    struct bplus_leaf *target = (pos <= keep) ? leaf : right;
+    if (target == right) {
+        pos -= keep;
+    }
+    memmove(&target->keys[pos + 1], &target->keys[pos],
+            sizeof(target->keys[0]) * (target->count - pos));
+    target->keys[pos] = data;
+    ++target->count;
+    ++tree->size;
+
+    int separator = right->keys[0];
+    void *new_child = right;
+
+    /* Walk back up, splitting every full ancestor into the siblings allocated above */
+    unsigned int next_sibling = 0;
+    while (depth > 0) {
+        --depth;
+        struct bplus_inner *parent = path[depth];
+        unsigned int index = path_index[depth];
+
+        if (parent->count < BPLUS_TREE_INNER_KEYS) {
+            inner_insert_at(parent, index, separator, new_child);
+            return 1;
+        }
+
+        /* Gather the overfull node's keys and children, then share them between two nodes */
+        int keys[BPLUS_TREE_INNER_KEYS + 1];
+        void *children[BPLUS_TREE_INNER_KEYS + 2];
+
+        memcpy(keys, parent->keys, sizeof(keys[0]) * index);
+        keys[index] = separator;
+        memcpy(&keys[index + 1], &parent->keys[index],
+               sizeof(keys[0]) * (BPLUS_TREE_INNER_KEYS - index));
+        memcpy(children, parent->children, sizeof(children[0]) * (index + 1));
+        children[index + 1] = new_child;
+        memcpy(&children[index + 2], &parent->children[index + 1],
+               sizeof(children[0]) * (BPLUS_TREE_INNER_KEYS - index));
+
+        struct bplus_inner *sibling = siblings[next_sibling++];
+        unsigned int mid = (BPLUS_TREE_INNER_KEYS + 1) / 2;
+        unsigned int right_keys = BPLUS_TREE_INNER_KEYS - mid;
+
+        for (unsigned int i = 0; i < BPLUS_TREE_INNER_KEYS; ++i) {
+            parent->keys[i] = (i < mid) ? keys[i] : INT_MAX;
+            parent->children[i] = (i <= mid) ? children[i] : NULL;
+        }
+        parent->children[BPLUS_TREE_INNER_KEYS] = NULL;
+        parent->count = mid;
+
+        memcpy(sibling->keys, &keys[mid + 1], sizeof(keys[0]) * right_keys);
+        memcpy(sibling->children, &children[mid + 1], sizeof(children[0]) * (right_keys + 1));
+        sibling->count = right_keys;
+
+        /* The middle key moves up rather than being copied, as in any inner-node split */
+        separator = keys[mid];
+        new_child = sibling;
+    }
+
+    /* The root itself split, so the tree grows by one level */
+    root->keys[0] = separator;
+    root->children[0] = tree->root;
+    root->children[1] = new_child;
+    root->count = 1;
+    tree->root = root;
+    ++tree->height;
+
+    return 1;
+}
+
+/**
+ * @brief Check if a value is in a B+ tree
+ *
+ * @param tree The tree to search
+ * @param data The value to search for
+ *
+ * @return int 1 if the value is found, or 0 otherwise
+ */
+int bplus_tree_is_in_tree(struct bplus_tree *tree, int data)
+{
+    if (!tree->root) {
+        return 0;
+    }
+
+    struct bplus_leaf *leaf = find_leaf(tree, data);
+    unsigned int pos = count_less(leaf->keys, BPLUS_TREE_LEAF_KEYS, data);
+
+    return pos < leaf->count && leaf->keys[pos] == data;
+}
+
+/**
+ * @brief Get the number of values in a B+ tree
+ *
+ * @param tree The tree to count
+ *
+ * @return unsigned int The number of values in the tree
+ */
+unsigned int bplus_tree_get_size(struct bplus_tree *tree)
+{
+    return tree->size;
+}
+
+/**
+ * @brief Get the minimum value in a B+ tree
+ *
+ * @param tree The tree to search
+ *
+ * @return int The minimum value in the tree, or INT_MAX if the tree is empty
+ */
+int bplus_tree_get_min(struct bplus_tree *tree)
+{
+    if (tree->size == 0) {
+        return INT_MAX;
+    }
+
+    return tree->first->keys[0];
+}
+
+/**
+ * @brief Get the maximum value in a B+ tree
+ *
+ * @param tree The tree to search
+ *
+ * @return int The maximum value in the tree, or INT_MAX if the tree is empty
+ */
+int bplus_tree_get_max(struct bplus_tree *tree)
+{
+    if (tree->size == 0) {
+        return INT_MAX;
+    }
+
+    void *node = tree->root;
+    for (unsigned int level = tree->height; level > 1; --level) {
+        struct bplus_inner *inner = node;
+        node = inner->children[inner->count];
+    }
+
+    struct bplus_leaf *leaf = node;
+    return leaf->keys[leaf->count - 1];
+}
+
+/**
+ * @brief Visit every value in a B+ tree that falls within a closed range, in ascending order
+ *
+ * Only one root-to-leaf descent is made. After that the scan follows the leaf chain.
+ *
+ * @param tree The tree to scan
+ * @param low The smallest value to visit
+ * @param high The largest value to visit
+ * @param visit Function called with each value in the range and the caller's context
+ * @param context Pointer passed through to the visit function
+ *
+ * @return unsigned int The number of values visited
+ */
+unsigned int bplus_tree_range(struct bplus_tree *tree, int low, int high,
+                              void (*visit)(int data, void *context), void *context)
+{
+    unsigned int visited = 0;
+
+    if (!tree->root || low > high) {
+        return 0;
+    }
+
+    struct bplus_leaf *leaf = find_leaf(tree, low);
+    unsigned int pos = count_less(leaf->keys, BPLUS_TREE_LEAF_KEYS, low);
+
+    while (leaf) {
+        for (; pos < leaf->count; ++pos) {
+            if (leaf->keys[pos] > high) {
+                return visited;
+            }
+            visit(leaf->keys[pos], context);
+            ++visited;
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+
+    return visited;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file bplus_tree.h
+ * @author agent <agent@local>
+ * @brief An in-memory B+ tree of integers with cache-line-sized nodes
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+/** Keys per leaf, chosen so that a leaf fills exactly two 64-byte cache lines. */
+#define BPLUS_TREE_LEAF_KEYS 29
+
+/** Keys per inner node, chosen so that an inner node fills exactly four cache lines. */
+#define BPLUS_TREE_INNER_KEYS 20
+
+/*
+ * Unused key slots always hold INT_MAX. Counting the keys smaller than a probe can then scan
+ * every slot without looking at the node's count, which keeps the search branch-free.
+ */
+
+struct bplus_leaf {
+    unsigned int count;                /** The number of keys in the leaf. */
+    int keys[BPLUS_TREE_LEAF_KEYS];    /** The keys, in ascending order. */
+    struct bplus_leaf *next;           /** The leaf holding the next larger keys, or NULL. */
+};
+
+struct bplus_inner {
+    unsigned int count;                 /** The number of separator keys in the node. */
+    int keys[BPLUS_TREE_INNER_KEYS];    /** keys[i] is the smallest key under children[i + 1]. */
+    void *children[BPLUS_TREE_INNER_KEYS + 1]; /** Inner nodes, or leaves on the last level. */
+};
+
+struct bplus_tree {
+    void *root;               /** The root node, a leaf when height is 1, or NULL if empty. */
+    struct bplus_leaf *first; /** The leaf holding the smallest keys. */
+    unsigned int height;      /** The number of levels in the tree, counting the leaves. */
+    unsigned int size;        /** The number of keys in the tree. */
+};
+
+/** Create a new B+ tree. */
+struct bplus_tree *bplus_tree_new(void);
+/** Free memory used by a B+ tree. */
+void bplus_tree_free(struct bplus_tree *tree);
+
+/** Insert a value into a B+ tree. */
+int bplus_tree_insert(struct bplus_tree *tree, int data);
+/** Check if a value is in a B+ tree. */
+int bplus_tree_is_in_tree(struct bplus_tree *tree, int data);
+
+/** Get the number of values in a B+ tree. */
+unsigned int bplus_tree_get_size(struct bplus_tree *tree);
+/** Get the minimum value in a B+ tree. */
+int bplus_tree_get_min(struct bplus_tree *tree);
+/** Get the maximum value in a B+ tree. */
+int bplus_tree_get_max(struct bplus_tree *tree);
+
+/** Visit every value within a closed range, in ascending order. */
+unsigned int bplus_tree_range(struct bplus_tree *tree, int low, int high,
+                              void (*visit)(int data, void *context), void *context);
+
+#endif /* BPLUS_TREE_H */
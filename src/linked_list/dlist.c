@@ -0,0 +1,425 @@
+/**
+ * @file dlist.c
+ * @author agent <agent@local>
+ * @brief A doubly-linked list implementation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#include "./dlist.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+/**
+ * @brief Create a new list node
+ *
+ * @param data The data to store in the new node
+ *
+ * @return struct dlist_node* A new list node containing the provided data
+ */
+static struct dlist_node *dlist_node_init(int data)
+{
+    struct dlist_node *new_node = malloc(sizeof(*new_node));
+    if (!new_node) {
+        return NULL;
+    }
+    new_node->data = data;
+    new_node->prev = NULL;
+    new_node->next = NULL;
+
+    return new_node;
+}
+
+/**
+ * @brief Create a new doubly-linked list
+ *
+ * @return struct dlist* Pointer to the new list structure
+ */
+struct dlist *dlist_init()
+{
+    struct dlist *list = malloc(sizeof(*list));
+    if (!list) {
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+
+    return list;
+}
+
+/**
+ * @brief Free the memory used by a doubly-linked list
+ *
+ * @param list The list to free memory from
+ */
+void dlist_free(struct dlist *list)
+{
+    if (!list) {
+        return;
+    }
+
+    struct dlist_node *current = list->head;
+    while (current) {
+        list->head = current->next;
+        free(current);
+        current = list->head;
+    }
+    free(list);
+}
+
+/**
+ * @brief Get the current size of a list
+ *
+ * @param list The list to check
+ *
+ * @return unsigned int The current size of the given list
+ */
+unsigned int dlist_size(struct dlist *list)
+{
+    if (!list) {
+        return 0;
+    }
+    return list->size;
+}
+
+/**
+ * @brief Determine whether a list is empty
+ *
+ * @param list The list to check
+ *
+ * @return int 1 if the list is empty, or 0 otherwise
+ */
+int dlist_empty(struct dlist *list)
+{
+    return (!list || list->size == 0);
+}
+
+/**
+ * @brief Get the node at a specific location in a list
+ *
+ * The walk starts from whichever end of the list is closer to the index.
+ *
+ * @param list The list to check
+ * @param index The position in the list to search for
+ *
+ * @return struct dlist_node* The node at the index, or NULL if the index is out of bounds
+ */
+struct dlist_node *dlist_node_at(struct dlist *list, unsigned int index)
+{
+    if (!list || index >= list->size) {
+        return NULL;
+    }
+
+    struct dlist_node *current;
+
+    if (index < list->size / 2) {
+        current = list->head;
+        for (unsigned int i = 0; i < index; ++i) {
+            current = current->next;
+        }
+    }
+    else {
+        current = list->tail;
+        for (unsigned int i = list->size - 1; i > index; --i) {
+            current = current->prev;
+        }
+    }
+
+    return current;
+}
+
+/**
+ * @brief Get the value stored at a specific location in a list
+ *
+ * @param list The list to check
+ * @param index The position in the list to search for
+ *
+ * @return int The value stored at the index, or INT_MAX if the index is out of bounds
+ */
+int dlist_value_at(struct dlist *list, unsigned int index)
+{
+    struct dlist_node *node = dlist_node_at(list, index);
+    if (!node) {
+        return INT_MAX;
+    }
+
+    return node->data;
+}
+
+/**
+ * @brief Get the value of the node at the nth position from the end of a list
+ *
+ * @param list The list to query
+ * @param n The position to check
+ *
+ * @return int The value at the node position, or INT_MAX if no such node exists
+ */
+int dlist_value_n_from_end(struct dlist *list, unsigned int n)
+{
+    if (dlist_empty(list) || n >= list->size) {
+        return INT_MAX;
+    }
+
+    return dlist_value_at(list, list->size - n - 1);
+}
+
+/**
+ * @brief Insert an item before a given node
+ *
+ * @param list The list to insert into
+ * @param node The node to insert before, or NULL to append to the end of the list
+ * @param data The value to insert
+ *
+ * @return struct dlist_node* The new node, or NULL if allocation fails
+ */
+struct dlist_node *dlist_insert_before(struct dlist *list, struct dlist_node *node, int data)
+{
+    if (!list) {
+        return NULL;
+    }
+
+    struct dlist_node *new_node = dlist_node_init(data);
+    if (!new_node) {
+        return NULL;
+    }
+
+    struct dlist_node *prev = node ? node->prev : list->tail;
+
+    new_node->prev = prev;
+    new_node->next = node;
+    if (prev) {
+        prev->next = new_node;
+    }
+    else {
+        list->head = new_node;
+    }
+    if (node) {
+        node->prev = new_node;
+    }
+    else {
+        list->tail = new_node;
+    }
+    ++list->size;
+
+    return new_node;
+}
+
+/**
+ * @brief Insert an item after a given node
+ *
+ * @param list The list to insert into
+ * @param node The node to insert after, or NULL to prepend to the start of the list
+ * @param data The value to insert
+ *
+ * @return struct dlist_node* The new node, or NULL if allocation fails
+ */
+struct dlist_node *dlist_insert_after(struct dlist *list, struct dlist_node *node, int data)
+{
+    if (!list) {
+        return NULL;
+    }
+
+    return dlist_insert_before(list, node ? node->next : list->head, data);
+}
+
+/**
+ * @brief Remove a given node from a list
+ *
+ * @param list The list to remove from
+ * @param node The node to remove, which must belong to the list
+ */
+void dlist_erase_node(struct dlist *list, struct dlist_node *node)
+{
+    if (!list || !node) {
+        return;
+    }
+
+    if (node->prev) {
+        node->prev->next = node->next;
+    }
+    else {
+        list->head = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+    else {
+        list->tail = node->prev;
+    }
+
+    free(node);
+    --list->size;
+}
+
+/**
+ * @brief Add an item to the front of a list
+ *
+ * @param list The list to add to
+ * @param data The item to add to the list
+ */
+void dlist_push_front(struct dlist *list, int data)
+{
+    dlist_insert_after(list, NULL, data);
+}
+
+/**
+ * @brief Remove the first item in a list and return its value
+ *
+ * @param list The list to pop from
+ *
+ * @return int The value of the first item in the list, or INT_MAX if the list is empty
+ */
+int dlist_pop_front(struct dlist *list)
+{
+    if (dlist_empty(list)) {
+        return INT_MAX;
+    }
+
+    int value = list->head->data;
+    dlist_erase_node(list, list->head);
+
+    return value;
+}
+
+/**
+ * @brief Add an item to the end of a list
+ *
+ * @param list The list to append to
+ * @param data The value to add to the list
+ */
+void dlist_push_back(struct dlist *list, int data)
+{
+    dlist_insert_before(list, NULL, data);
+}
+
+/**
+ * @brief Remove the last item in a list and return its value
+ *
+ * @param list The list to pop from
+ *
+ * @return int The value of the last item in the list, or INT_MAX if the list is empty
+ */
+int dlist_pop_back(struct dlist *list)
+{
+    if (dlist_empty(list)) {
+        return INT_MAX;
+    }
+
+    int value = list->tail->data;
+    dlist_erase_node(list, list->tail);
+
+    return value;
+}
+
+/**
+ * @brief Get the value of the first item in a list
+ *
+ * @param list The list to query
+ *
+ * @return int The value of the first item in the list, or INT_MAX if no such item exists
+ */
+int dlist_front(struct dlist *list)
+{
+    if (dlist_empty(list)) {
+        return INT_MAX;
+    }
+
+    return list->head->data;
+}
+
+/**
+ * @brief Get the value of the last item in a list
+ *
+ * @param list The list to query
+ *
+ * @return int The value of the last item in the list, or INT_MAX if no such item exists
+ */
+int dlist_back(struct dlist *list)
+{
+    if (dlist_empty(list)) {
+        return INT_MAX;
+    }
+
+    return list->tail->data;
+}
+
+/**
+ * @brief Insert an item at a specific index in a list
+ *
+ * As with linked_list_insert, the index must refer to an existing item, which is moved back
+ * by one position.
+ *
+ * @param list The list to insert into
+ * @param index The position in the list to insert into
+ * @param data The value to insert into the list
+ */
+void dlist_insert(struct dlist *list, unsigned int index, int data)
+{
+    struct dlist_node *node = dlist_node_at(list, index);
+    if (!node) {
+        return;
+    }
+
+    dlist_insert_before(list, node, data);
+}
+
+/**
+ * @brief Remove an item at a specific index in a list
+ *
+ * @param list The list to erase from
+ * @param index The position in the list to erase
+ */
+void dlist_erase(struct dlist *list, unsigned int index)
+{
+    dlist_erase_node(list, dlist_node_at(list, index));
+}
+
+/**
+ * @brief Remove the first occurrance of a given value from a list
+ *
+ * @param list The list to remove from
+ * @param value The value to remove
+ */
+void dlist_remove_value(struct dlist *list, int value)
+{
+    if (dlist_empty(list)) {
+        return;
+    }
+
+    struct dlist_node *current = list->head;
+    while (current && current->data != value) {
+        current = current->next;
+    }
+
+    dlist_erase_node(list, current);
+}
+
+/**
+ * @brief Reverse a list
+ *
+ * @param list The list to reverse
+ */
+void dlist_reverse(struct dlist *list)
+{
+    if (dlist_empty(list) || list->size == 1) {
+        return;
+    }
+
+    struct dlist_node *current = list->head;
+    while (current) {
+        struct dlist_node *next = current->next;
+        current->next = current->prev;
+        current->prev = next;
+        current = next;
+    }
+
+    current = list->head;
+    list->head = list->tail;
+    list->tail = current;
+}
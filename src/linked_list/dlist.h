@@ -0,0 +1,87 @@
+/**
+ * @file dlist.h
+ * @author agent <agent@local>
+ * @brief A doubly-linked list implementation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef DLIST_H
+#define DLIST_H
+
+struct dlist_node {
+    int data;
+    struct dlist_node *prev;
+    struct dlist_node *next;
+};
+
+struct dlist {
+    struct dlist_node *head;
+    struct dlist_node *tail;
+    unsigned int size;
+};
+
+/** Create a new doubly-linked list */
+struct dlist *dlist_init();
+
+/** Free memory used by a doubly-linked list */
+void dlist_free(struct dlist *list);
+
+/** Get the current size of a list */
+unsigned int dlist_size(struct dlist *list);
+
+/** Determine whether a list is empty */
+int dlist_empty(struct dlist *list);
+
+/** Get the node at a specific location in a list */
+struct dlist_node *dlist_node_at(struct dlist *list, unsigned int index);
+
+/** Get the value stored at a specific location in a list */
+int dlist_value_at(struct dlist *list, unsigned int index);
+
+/** Get the value of the node at the nth position from the end of a list */
+int dlist_value_n_from_end(struct dlist *list, unsigned int n);
+
+/** Add an item to the front of a list */
+void dlist_push_front(struct dlist *list, int data);
+
+/** Remove the first item in a list and return its value */
+int dlist_pop_front(struct dlist *list);
+
+/** Add an item to the end of a list */
+void dlist_push_back(struct dlist *list, int data);
+
+/** Remove the last item in a list and return its value */
+int dlist_pop_back(struct dlist *list);
+
+/** Get the value of the first item in a list */
+int dlist_front(struct dlist *list);
+
+/** Get the value of the last item in a list */
+int dlist_back(struct dlist *list);
+
+/** Insert an item before a given node */
+struct dlist_node *dlist_insert_before(struct dlist *list, struct dlist_node *node, int data);
+
+/** Insert an item after a given node */
+struct dlist_node *dlist_insert_after(struct dlist *list, struct dlist_node *node, int data);
+
+/** Remove a given node from a list */
+void dlist_erase_node(struct dlist *list, struct dlist_node *node);
+
+/** Insert an item at a specific index in a list */
+void dlist_insert(struct dlist *list, unsigned int index, int data);
+
+/** Remove an item at a specific index in a list */
+void dlist_erase(struct dlist *list, unsigned int index);
+
+/** Remove the first occurrance of a given value from a list */
+void dlist_remove_value(struct dlist *list, int value);
+
+/** Reverse a list */
+void dlist_reverse(struct dlist *list);
+
+#endif /* DLIST_H */
@@ -12,8 +12,23 @@
 #include "./linked_list.h"
 
 #include <limits.h>
+#include <pthread.h>
 #include <stdlib.h>
 
+/** The number of nodes a pool allocates at a time when no slab size is given. */
+#define NODE_POOL_DEFAULT_SLAB_SIZE 256
+
+/** Lists shorter than this are not worth sorting on more than one thread. */
+#define LINKED_LIST_PARALLEL_SORT_MIN 8192
+
+/** The most threads linked_list_sort_parallel will use. */
+#define LINKED_LIST_PARALLEL_SORT_MAX_THREADS 64
+
+struct node_slab {
+    struct node_slab *next; /** The previously allocated slab. */
+    struct node nodes[];
+};
+
 /**
  * @brief Create a new list node
  *
@@ -43,12 +58,148 @@ void node_free(struct node *node)
     free(node);
 }
 
+/**
+ * @brief Create a pool of list nodes
+ *
+ * A pool can be shared by any number of lists and must outlive all of them. Nodes are
+ * allocated in contiguous slabs and recycled through a free list, so pushing and popping in a
+ * steady state never calls malloc or free.
+ *
+ * @param slab_size The number of nodes to allocate at a time, or 0 for a default
+ *
+ * @return struct node_pool* Pointer to the new pool, or NULL if allocation fails
+ */
+struct node_pool *node_pool_init(unsigned int slab_size)
+{
+    struct node_pool *pool = malloc(sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->free_list = NULL;
+    pool->slabs = NULL;
+    pool->slab_size = slab_size ? slab_size : NODE_POOL_DEFAULT_SLAB_SIZE;
+
+    return pool;
+}
+
+/**
+ * @brief Free memory used by a node pool, including every node it handed out
+ *
+ * @param pool The pool to free
+ */
+void node_pool_free(struct node_pool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    struct node_slab *slab = pool->slabs;
+    while (slab) {
+        struct node_slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(pool);
+}
+
+/**
+ * @brief Take a node from a pool
+ *
+ * @param pool The pool to allocate from
+ * @param data The data to store in the node
+ *
+ * @return struct node* A node containing the provided data, or NULL if allocation fails
+ */
+struct node *node_pool_alloc(struct node_pool *pool, int data)
+{
+    if (!pool->free_list) {
+        struct node_slab *slab =
+            malloc(sizeof(*slab) + sizeof(struct node) * pool->slab_size);
+        if (!slab) {
+            return NULL;
+        }
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+
+        /* Chain the new nodes in address order so consecutive pushes get neighboring nodes */
+        for (unsigned int i = 0; i + 1 < pool->slab_size; ++i) {
+            slab->nodes[i].next = &slab->nodes[i + 1];
+        }
+        slab->nodes[pool->slab_size - 1].next = NULL;
+        pool->free_list = slab->nodes;
+    }
+
+    struct node *new_node = pool->free_list;
+    pool->free_list = new_node->next;
+    new_node->data = data;
+    new_node->next = NULL;
+
+    return new_node;
+}
+
+/**
+ * @brief Return a node to a pool so that it can be handed out again
+ *
+ * @param pool The pool the node was taken from
+ * @param node The node to release
+ */
+void node_pool_release(struct node_pool *pool, struct node *node)
+{
+    node->next = pool->free_list;
+    pool->free_list = node;
+}
+
+/**
+ * @brief Create a node for a list, using the list's pool if it has one
+ *
+ * @param list The list the node is for
+ * @param data The data to store in the new node
+ *
+ * @return struct node* A new list node containing the provided data
+ */
+static struct node *list_node_init(struct linked_list *list, int data)
+{
+    if (list->pool) {
+        return node_pool_alloc(list->pool, data);
+    }
+    return node_init(data);
+}
+
+/**
+ * @brief Free a node that belongs to a list, returning it to the list's pool if it has one
+ *
+ * @param list The list the node belonged to
+ * @param node The node to free
+ */
+static void list_node_free(struct linked_list *list, struct node *node)
+{
+    if (list->pool) {
+        node_pool_release(list->pool, node);
+    }
+    else {
+        node_free(node);
+    }
+}
+
 /**
  * @brief Create a new linked list
  *
  * @return struct linked_list* Pointer to the new linked list structure
  */
 struct linked_list *linked_list_init()
+{
+    return linked_list_init_with_pool(NULL);
+}
+
+/**
+ * @brief Create a new linked list that takes its nodes from a pool
+ *
+ * @param pool The pool to allocate nodes from, or NULL to allocate each node with malloc
+ *
+ * @return struct linked_list* Pointer to the new linked list structure
+ */
+struct linked_list *linked_list_init_with_pool(struct node_pool *pool)
 {
     struct linked_list *list = malloc(sizeof(*list));
     if (!list) {
@@ -58,6 +209,7 @@ struct linked_list *linked_list_init()
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->pool = pool;
 
     return list;
 }
@@ -76,7 +228,7 @@ void linked_list_free(struct linked_list *list)
     struct node *current = list->head;
     while (current) {
         list->head = current->next;
-        node_free(current);
+        list_node_free(list, current);
         current = list->head;
     }
     free(list);
@@ -160,7 +312,10 @@ void linked_list_push_front(struct linked_list *list, int data)
         return;
     }
 
-    struct node *new_node = node_init(data);
+    struct node *new_node = list_node_init(list, data);
+    if (!new_node) {
+        return;
+    }
 
     if (!list->head) {
         list->head = new_node;
@@ -188,9 +343,12 @@ int linked_list_pop_front(struct linked_list *list)
 
     struct node *current = list->head;
     list->head = list->head->next;
+    if (!list->head) {
+        list->tail = NULL;
+    }
 
     int value = current->data;
-    node_free(current);
+    list_node_free(list, current);
     --list->size;
 
     return value;
@@ -208,7 +366,10 @@ void linked_list_push_back(struct linked_list *list, int data)
         return;
     }
 
-    struct node *new_node = node_init(data);
+    struct node *new_node = list_node_init(list, data);
+    if (!new_node) {
+        return;
+    }
 
     if (!list->head) {
         list->head = new_node;
@@ -238,7 +399,7 @@ int linked_list_pop_back(struct linked_list *list)
     int value = list->tail->data;
 
     if (list->size == 1) {
-        node_free(list->head);
+        list_node_free(list, list->head);
         list->head = NULL;
         list->tail = NULL;
     }
@@ -248,7 +409,8 @@ int linked_list_pop_back(struct linked_list *list)
             current = current->next;
         }
 
-        node_free(list->tail);
+        list_node_free(list, list->tail);
+        current->next = NULL;
         list->tail = current;
     }
     --list->size;
@@ -306,7 +468,10 @@ void linked_list_insert(struct linked_list *list, unsigned int index, int data)
     }
     else {
         struct node *current = list->head;
-        struct node *new_node = node_init(data);
+        struct node *new_node = list_node_init(list, data);
+        if (!new_node) {
+            return;
+        }
 
         for (int i = 0; i < index - 1; ++i) {
             current = current->next;
@@ -331,9 +496,10 @@ void linked_list_erase(struct linked_list *list, unsigned int index)
     }
 
     if (list->size == 1) {
-        node_free(list->head);
+        list_node_free(list, list->head);
         list->head = NULL;
         list->tail = NULL;
+        --list->size;
     }
     else {
         if (index == 0) {
@@ -350,7 +516,7 @@ void linked_list_erase(struct linked_list *list, unsigned int index)
 
             struct node *to_erase = current->next;
             current->next = to_erase->next;
-            node_free(to_erase);
+            list_node_free(list, to_erase);
             --list->size;
         }
     }
@@ -373,16 +539,19 @@ void linked_list_remove_value(struct linked_list *list, int value)
     }
     else {
         struct node *current = list->head;
-        while (current) {
+        while (current->next) {
             if (current->next->data == value) {
                 struct node *to_remove = current->next;
                 current->next = to_remove->next;
-                node_free(to_remove);
+                if (list->tail == to_remove) {
+                    list->tail = current;
+                }
+                list_node_free(list, to_remove);
+                --list->size;
                 break;
             }
             current = current->next;
         }
-        --list->size;
     }
 }
 
@@ -401,6 +570,7 @@ void linked_list_reverse(struct linked_list *list)
     struct node *current = list->head;
     struct node *next = NULL;
 
+    list->tail = list->head;
     while (current) {
         next = current->next;
         current->next = prev;
@@ -408,4 +578,538 @@ void linked_list_reverse(struct linked_list *list)
         current = next;
     }
     list->head = prev;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Move a list's items into a list that takes its nodes from another pool
+ *
+ * Lists that get their nodes from different places cannot share nodes, so the items are copied
+ * into nodes from the destination's pool. The copy is built in full before the old nodes are
+ * released, so a failed allocation leaves the list unchanged. When the pools match, the nodes
+ * are handed over as they are. Either way the list keeps its own pool and is left empty.
+ *
+ * @param list The list whose items should be moved
+ * @param moved An empty list whose pool is the destination, which receives the items
+ *
+ * @return int 1 if the items were moved, or 0 if allocation failed
+ */
+static int move_to_pool(struct linked_list *list, struct linked_list *moved)
+{
+    if (list->pool == moved->pool) {
+        moved->head = list->head;
+        moved->tail = list->tail;
+    }
+    else {
+        for (struct node *current = list->head; current; current = current->next) {
+            struct node *new_node = list_node_init(moved, current->data);
+            if (!new_node) {
+                while (moved->head) {
+                    struct node *next = moved->head->next;
+                    list_node_free(moved, moved->head);
+                    moved->head = next;
+                }
+                moved->tail = NULL;
+                return 0;
+            }
+
+            if (moved->tail) {
+                moved->tail->next = new_node;
+            }
+            else {
+                moved->head = new_node;
+            }
+            moved->tail = new_node;
+        }
+
+        while (list->head) {
+            struct node *next = list->head->next;
+            list_node_free(list, list->head);
+            list->head = next;
+        }
+    }
+    moved->size = list->size;
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+
+    return 1;
+}
+
+/**
+ * @brief Move every item from one list to the end of another
+ *
+ * When both lists take their nodes from the same place this is O(1): the source's nodes are
+ * linked onto the destination's tail. Otherwise the nodes are copied into the destination's
+ * pool first. The source list is left empty.
+ *
+ * @param dst The list to append to
+ * @param src The list to move items from
+ *
+ * @return int 1 on success, or 0 if allocation failed, in which case neither list changes
+ */
+int linked_list_concat(struct linked_list *dst, struct linked_list *src)
+{
+    if (!dst || !src || dst == src) {
+        return 0;
+    }
+
+    return linked_list_splice(dst, dst->size, src);
+}
+
+/**
+ * @brief Move every item from one list into another at a specific index
+ *
+ * The first moved item ends up at the index. Finding the index walks the list, but moving the
+ * items takes a few pointer writes no matter how many there are, as long as both lists take
+ * their nodes from the same place. The other list is left empty.
+ *
+ * @param list The list to insert into
+ * @param index The position to insert at, from 0 up to and including the list's size
+ * @param other The list to move items from
+ *
+ * @return int 1 on success, or 0 if the index is out of bounds or allocation failed
+ */
+int linked_list_splice(struct linked_list *list, unsigned int index, struct linked_list *other)
+{
+    if (!list || !other || list == other || index > list->size) {
+        return 0;
+    }
+    if (linked_list_empty(other)) {
+        return 1;
+    }
+    struct linked_list moved = {NULL, NULL, 0, list->pool};
+    if (!move_to_pool(other, &moved)) {
+        return 0;
+    }
+
+    if (index == 0) {
+        moved.tail->next = list->head;
+        list->head = moved.head;
+        if (!list->tail) {
+            list->tail = moved.tail;
+        }
+    }
+    else {
+        struct node *prev = list->tail;
+        if (index < list->size) {
+            prev = list->head;
+            for (unsigned int i = 1; i < index; ++i) {
+                prev = prev->next;
+            }
+        }
+
+        moved.tail->next = prev->next;
+        prev->next = moved.head;
+        if (prev == list->tail) {
+            list->tail = moved.tail;
+        }
+    }
+    list->size += moved.size;
+
+    return 1;
+}
+
+/**
+ * @brief Split a list in two at a specific index
+ *
+ * The items from the index onward are moved to a new list that shares the original's node
+ * pool. Only the walk to the index costs anything; the moved items are not touched.
+ *
+ * @param list The list to split
+ * @param index The position of the first item to move, from 0 up to and including the size
+ *
+ * @return struct linked_list* A new list holding the moved items, or NULL if the index is out
+ *         of bounds or allocation failed
+ */
+struct linked_list *linked_list_split(struct linked_list *list, unsigned int index)
+{
+    if (!list || index > list->size) {
+        return NULL;
+    }
+
+    struct linked_list *rest = linked_list_init_with_pool(list->pool);
+    if (!rest || index == list->size) {
+        return rest;
+    }
+
+    rest->tail = list->tail;
+    rest->size = list->size - index;
+
+    if (index == 0) {
+        rest->head = list->head;
+        list->head = NULL;
+        list->tail = NULL;
+    }
+    else {
+        struct node *last = list->head;
+        for (unsigned int i = 1; i < index; ++i) {
+            last = last->next;
+        }
+        rest->head = last->next;
+        last->next = NULL;
+        list->tail = last;
+    }
+    list->size = index;
+
+    return rest;
+}
+
+/**
+ * @brief Merge two sorted chains of nodes into one
+ *
+ * Equal values keep their relative order, with those from the first chain coming first. The
+ * merged chain ends with whatever is left of one of the inputs, so its tail is that input's
+ * tail and the leftover nodes are never walked.
+ *
+ * @param a The first sorted chain, which must not be empty
+ * @param a_tail The last node of the first chain
+ * @param b The second sorted chain, which must not be empty
+ * @param b_tail The last node of the second chain
+ * @param tail Set to the last node of the merged chain
+ *
+ * @return struct node* The first node of the merged chain
+ */
+static struct node *merge_chains(struct node *a, struct node *a_tail, struct node *b,
+                                 struct node *b_tail, struct node **tail)
+{
+    struct node merged;
+    struct node *last = &merged;
+
+    while (a && b) {
+        if (b->data < a->data) {
+            last->next = b;
+            b = b->next;
+        }
+        else {
+            last->next = a;
+            a = a->next;
+        }
+        last = last->next;
+    }
+
+    if (a) {
+        last->next = a;
+        *tail = a_tail;
+    }
+    else {
+        last->next = b;
+        *tail = b_tail;
+    }
+
+    return merged.next;
+}
+
+/**
+ * @brief Sort a chain of nodes by relinking them
+ *
+ * This is a bottom-up merge sort. Runs of 1, 2, 4, ... nodes are kept in bins, and each node
+ * taken from the chain is merged upward like a carry in binary addition. Nothing is allocated
+ * and there is no recursion, and nearly all merges are between runs of equal length.
+ *
+ * @param head The first node of the chain, which must end in NULL
+ * @param tail Set to the last node of the sorted chain
+ *
+ * @return struct node* The first node of the sorted chain
+ */
+static struct node *sort_chain(struct node *head, struct node **tail)
+{
+    /* Bin i holds a sorted run of 2^i nodes, enough for any list an unsigned int can count */
+    struct node *bins[sizeof(unsigned int) * 8 + 1] = {NULL};
+    struct node *bin_tails[sizeof(unsigned int) * 8 + 1];
+    unsigned int used = 0;
+
+    while (head) {
+        struct node *run = head;
+        struct node *run_tail = head;
+        head = head->next;
+        run->next = NULL;
+
+        unsigned int i = 0;
+        for (; i < used && bins[i]; ++i) {
+            run = merge_chains(bins[i], bin_tails[i], run, run_tail, &run_tail);
+            bins[i] = NULL;
+        }
+        if (i == used) {
+            ++used;
+        }
+        bins[i] = run;
+        bin_tails[i] = run_tail;
+    }
+
+    /* Fold the bins together, smallest runs first */
+    struct node *sorted = NULL;
+    struct node *sorted_tail = NULL;
+    for (unsigned int i = 0; i < used; ++i) {
+        if (!bins[i]) {
+            continue;
+        }
+        if (sorted) {
+            sorted = merge_chains(bins[i], bin_tails[i], sorted, sorted_tail, &sorted_tail);
+        }
+        else {
+            sorted = bins[i];
+            sorted_tail = bin_tails[i];
+        }
+    }
+    *tail = sorted_tail;
+
+    return sorted;
+}
+
+/**
+ * @brief Sort a list in ascending order
+ *
+ * The existing nodes are relinked, so sorting allocates nothing and copies no values. The sort
+ * is stable.
+ *
+ * @param list The list to sort
+ */
+void linked_list_sort(struct linked_list *list)
+{
+    if (linked_list_empty(list) || list->size == 1) {
+        return;
+    }
+
+    list->head = sort_chain(list->head, &list->tail);
+}
+
+struct sort_segment {
+    struct node *head; /** The first node of the segment. */
+    struct node *tail; /** The last node of the segment once it is sorted. */
+};
+
+/**
+ * @brief Sort one segment of a list. Used as a thread's start routine.
+ *
+ * @param arg The struct sort_segment to sort
+ *
+ * @return void* Always NULL
+ */
+static void *sort_segment(void *arg)
+{
+    struct sort_segment *segment = arg;
+    segment->head = sort_chain(segment->head, &segment->tail);
+
+    return NULL;
+}
+
+/**
+ * @brief Sort a list in ascending order using several threads
+ *
+ * The list is cut into one segment per thread, the segments are sorted at the same time, and
+ * the sorted segments are merged pairwise. Short lists are sorted on the calling thread, since
+ * starting threads would cost more than it saves. The sort is stable.
+ *
+ * @param list The list to sort
+ * @param threads The number of threads to sort with, including the calling thread
+ */
+void linked_list_sort_parallel(struct linked_list *list, unsigned int threads)
+{
+    if (threads > LINKED_LIST_PARALLEL_SORT_MAX_THREADS) {
+        threads = LINKED_LIST_PARALLEL_SORT_MAX_THREADS;
+    }
+    if (linked_list_empty(list) || threads < 2 || list->size < LINKED_LIST_PARALLEL_SORT_MIN) {
+        linked_list_sort(list);
+        return;
+    }
+
+    struct sort_segment segments[LINKED_LIST_PARALLEL_SORT_MAX_THREADS];
+    pthread_t workers[LINKED_LIST_PARALLEL_SORT_MAX_THREADS];
+    int started[LINKED_LIST_PARALLEL_SORT_MAX_THREADS];
+
+    /* Cut the list into segments whose lengths differ by at most one */
+    struct node *current = list->head;
+    for (unsigned int i = 0; i < threads; ++i) {
+        unsigned int length = list->size / threads + (i < list->size % threads);
+
+        segments[i].head = current;
+        for (unsigned int j = 1; j < length; ++j) {
+            current = current->next;
+        }
+        struct node *next = current->next;
+        current->next = NULL;
+        current = next;
+    }
+
+    /* The calling thread sorts the first segment itself, and any segment whose thread failed */
+    for (unsigned int i = 1; i < threads; ++i) {
+        started[i] = pthread_create(&workers[i], NULL, sort_segment, &segments[i]) == 0;
+    }
+    sort_segment(&segments[0]);
+    for (unsigned int i = 1; i < threads; ++i) {
+        if (started[i]) {
+            pthread_join(workers[i], NULL);
+        }
+        else {
+            sort_segment(&segments[i]);
+        }
+    }
+
+    /* Merge neighbouring segments so every merge is between runs of similar length */
+    for (unsigned int width = 1; width < threads; width *= 2) {
+        for (unsigned int i = 0; i + width < threads; i += width * 2) {
+            segments[i].head =
+                merge_chains(segments[i].head, segments[i].tail, segments[i + width].head,
+                             segments[i + width].tail, &segments[i].tail);
+        }
+    }
+    list->head = segments[0].head;
+    list->tail = segments[0].tail;
+}
+
+/**
+ * @brief Place a cursor on the first item in a list
+ *
+ * A cursor remembers its position, so walking and editing a list through one costs O(1) per
+ * step instead of the O(n) walk from the head that each index-based call makes. Changing the
+ * list other than through the cursor invalidates it.
+ *
+ * @param cursor The cursor to initialize
+ * @param list The list to walk
+ */
+void linked_list_cursor_init(struct linked_list_cursor *cursor, struct linked_list *list)
+{
+    cursor->list = list;
+    cursor->prev = NULL;
+    cursor->current = list ? list->head : NULL;
+}
+
+/**
+ * @brief Determine whether a cursor is on an item
+ *
+ * @param cursor The cursor to check
+ *
+ * @return int 1 if the cursor is on an item, or 0 if it has moved past the end of the list
+ */
+int linked_list_cursor_valid(struct linked_list_cursor *cursor)
+{
+    return cursor->current != NULL;
+}
+
+/**
+ * @brief Move a cursor to the next item in its list
+ *
+ * @param cursor The cursor to move
+ */
+void linked_list_cursor_next(struct linked_list_cursor *cursor)
+{
+    if (!cursor->current) {
+        return;
+    }
+
+    cursor->prev = cursor->current;
+    cursor->current = cursor->current->next;
+}
+
+/**
+ * @brief Get the value of the item a cursor is on
+ *
+ * @param cursor The cursor to query
+ *
+ * @return int The value of the item, or INT_MAX if the cursor is past the end of the list
+ */
+int linked_list_cursor_get(struct linked_list_cursor *cursor)
+{
+    if (!cursor->current) {
+        return INT_MAX;
+    }
+
+    return cursor->current->data;
+}
+
+/**
+ * @brief Insert an item after the one a cursor is on
+ *
+ * The cursor stays where it is, so the new item is the next one it visits.
+ *
+ * @param cursor The cursor to insert after
+ * @param data The value to insert
+ *
+ * @return int 1 if the item was inserted, or 0 if the cursor is past the end of the list or
+ *         allocation failed
+ */
+int linked_list_cursor_insert_after(struct linked_list_cursor *cursor, int data)
+{
+    if (!cursor->current) {
+        return 0;
+    }
+
+    struct linked_list *list = cursor->list;
+    struct node *new_node = list_node_init(list, data);
+    if (!new_node) {
+        return 0;
+    }
+
+    new_node->next = cursor->current->next;
+    cursor->current->next = new_node;
+    if (list->tail == cursor->current) {
+        list->tail = new_node;
+    }
+    ++list->size;
+
+    return 1;
+}
+
+/**
+ * @brief Remove the item after the one a cursor is on and return its value
+ *
+ * @param cursor The cursor to erase after
+ *
+ * @return int The value of the removed item, or INT_MAX if there is no such item
+ */
+int linked_list_cursor_erase_after(struct linked_list_cursor *cursor)
+{
+    if (!cursor->current || !cursor->current->next) {
+        return INT_MAX;
+    }
+
+    struct linked_list *list = cursor->list;
+    struct node *to_erase = cursor->current->next;
+    int value = to_erase->data;
+
+    cursor->current->next = to_erase->next;
+    if (list->tail == to_erase) {
+        list->tail = cursor->current;
+    }
+    list_node_free(list, to_erase);
+    --list->size;
+
+    return value;
+}
+
+/**
+ * @brief Remove the item a cursor is on, moving the cursor to the next item
+ *
+ * Because the cursor tracks the item before its own, this is also O(1), which makes filtering
+ * a list in a single pass straightforward.
+ *
+ * @param cursor The cursor whose item should be removed
+ *
+ * @return int The value of the removed item, or INT_MAX if the cursor is past the end of the list
+ */
+int linked_list_cursor_erase(struct linked_list_cursor *cursor)
+{
+    if (!cursor->current) {
+        return INT_MAX;
+    }
+
+    struct linked_list *list = cursor->list;
+    struct node *to_erase = cursor->current;
+    int value = to_erase->data;
+
+    if (cursor->prev) {
+        cursor->prev->next = to_erase->next;
+    }
+    else {
+        list->head = to_erase->next;
+    }
+    if (list->tail == to_erase) {
+        list->tail = cursor->prev;
+    }
+    cursor->current = to_erase->next;
+    list_node_free(list, to_erase);
+    --list->size;
+
+    return value;
+}
@@ -17,10 +17,25 @@ struct node {
     struct node *next;
 };
 
+struct node_slab;
+
+struct node_pool {
+    struct node *free_list;  /** Nodes ready to be handed out, chained by their next pointers. */
+    struct node_slab *slabs; /** Blocks of nodes owned by the pool. */
+    unsigned int slab_size;  /** The number of nodes allocated at a time. */
+};
+
 struct linked_list {
     struct node *head;
     struct node *tail;
     unsigned int size;
+    struct node_pool *pool; /** Where nodes come from, or NULL to use malloc and free. */
+};
+
+struct linked_list_cursor {
+    struct linked_list *list; /** The list being walked. */
+    struct node *prev;        /** The node before the current one, or NULL at the head. */
+    struct node *current;     /** The node the cursor is on, or NULL past the end. */
 };
 
 /** Create a new list node */
@@ -29,9 +44,24 @@ struct node *node_init(int data);
 /** Free memory used by a node */
 void node_free(struct node *node);
 
+/** Create a pool of list nodes */
+struct node_pool *node_pool_init(unsigned int slab_size);
+
+/** Free memory used by a node pool and every node it handed out */
+void node_pool_free(struct node_pool *pool);
+
+/** Take a node from a pool */
+struct node *node_pool_alloc(struct node_pool *pool, int data);
+
+/** Return a node to a pool */
+void node_pool_release(struct node_pool *pool, struct node *node);
+
 /** Create a new linked list */
 struct linked_list *linked_list_init();
 
+/** Create a new linked list that takes its nodes from a pool */
+struct linked_list *linked_list_init_with_pool(struct node_pool *pool);
+
 /** Free memory used by a linked list */
 void linked_list_free(struct linked_list *list);
 
@@ -45,7 +75,7 @@ int linked_list_empty(struct linked_list *list);
 int linked_list_value_at(struct linked_list *list, unsigned int index);
 
 /** Get the value of the node at the nth position from the end of a list */
-int linke_list_value_n_from_end(struct linked_list *list, unsigned int n);
+int linked_list_value_n_from_end(struct linked_list *list, unsigned int n);
 
 /** Add an item to the front of a list */
 void linked_list_push_front(struct linked_list *list, int data);
@@ -77,4 +107,40 @@ void linked_list_remove_value(struct linked_list *list, int value);
 /** Reverse a list */
 void linked_list_reverse(struct linked_list *list);
 
+/** Move every item from one list to the end of another */
+int linked_list_concat(struct linked_list *dst, struct linked_list *src);
+
+/** Move every item from one list into another at a specific index */
+int linked_list_splice(struct linked_list *list, unsigned int index, struct linked_list *other);
+
+/** Split a list in two at a specific index */
+struct linked_list *linked_list_split(struct linked_list *list, unsigned int index);
+
+/** Sort a list in ascending order */
+void linked_list_sort(struct linked_list *list);
+
+/** Sort a list in ascending order using several threads */
+void linked_list_sort_parallel(struct linked_list *list, unsigned int threads);
+
+/** Place a cursor on the first item in a list */
+void linked_list_cursor_init(struct linked_list_cursor *cursor, struct linked_list *list);
+
+/** Determine whether a cursor is on an item */
+int linked_list_cursor_valid(struct linked_list_cursor *cursor);
+
+/** Move a cursor to the next item in its list */
+void linked_list_cursor_next(struct linked_list_cursor *cursor);
+
+/** Get the value of the item a cursor is on */
+int linked_list_cursor_get(struct linked_list_cursor *cursor);
+
+/** Insert an item after the one a cursor is on */
+int linked_list_cursor_insert_after(struct linked_list_cursor *cursor, int data);
+
+/** Remove the item after the one a cursor is on and return its value */
+int linked_list_cursor_erase_after(struct linked_list_cursor *cursor);
+
+/** Remove the item a cursor is on, moving the cursor to the next item */
+int linked_list_cursor_erase(struct linked_list_cursor *cursor);
+
 #endif /* LINKED_LIST_H */
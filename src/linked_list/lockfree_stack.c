@@ -0,0 +1,199 @@
+/**
+ * @file lockfree_stack.c
+ * @author agent <agent@local>
+ * @brief A stack that any number of threads can push to and pop from without a lock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * This is a Treiber stack: the top of the stack is a single word that is swapped with
+ * compare-and-swap. A plain pointer would suffer from the ABA problem, where a thread reads the
+ * top node A and the node below it, other threads pop A, pop more and push A back, and the first
+ * thread's swap then succeeds and installs a node that is no longer on the stack.
+ *
+ * To rule this out, nodes live in one array and are linked by 32-bit index. The top word holds
+ * the index in its low half and a tag in its high half, and every successful swap bumps the tag,
+ * so a stale swap always fails. Unused nodes are kept on a second stack that works the same way.
+ * Nodes are never returned to the system while the stack exists, so a thread holding a stale
+ * index reads valid, if outdated, memory.
+ */
+
+#include "./lockfree_stack.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+_Static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "the tagged top of the stack must be lock-free");
+
+/**
+ * @brief Combine a node index and a tag into a word for the top of a stack
+ *
+ * @param index The index of the top node
+ * @param tag The number of changes made to the top so far
+ *
+ * @return uint64_t The tagged index
+ */
+static inline uint64_t tagged(uint32_t index, uint32_t tag)
+{
+    return ((uint64_t)tag << 32) | index;
+}
+
+/**
+ * @brief Push a node onto one of a lock-free stack's chains
+ *
+ * @param stack The stack that owns the node
+ * @param top The top of the chain to push onto
+ * @param index The index of the node to push
+ */
+static void push_index(struct lockfree_stack *stack, _Atomic(uint64_t) *top, uint32_t index)
+{
+    struct lockfree_node *node = &stack->nodes[index];
+    uint64_t old = atomic_load_explicit(top, memory_order_relaxed);
+
+    do {
+        atomic_store_explicit(&node->next, (uint32_t)old, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(top, &old, tagged(index, (old >> 32) + 1),
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+/**
+ * @brief Pop a node off one of a lock-free stack's chains
+ *
+ * @param stack The stack that owns the chain
+ * @param top The top of the chain to pop from
+ *
+ * @return uint32_t The index of the popped node, or LOCKFREE_STACK_NIL if the chain is empty
+ */
+static uint32_t pop_index(struct lockfree_stack *stack, _Atomic(uint64_t) *top)
+{
+    uint64_t old = atomic_load_explicit(top, memory_order_acquire);
+
+    for (;;) {
+        uint32_t index = (uint32_t)old;
+        if (index == LOCKFREE_STACK_NIL) {
+            return LOCKFREE_STACK_NIL;
+        }
+
+        /* This node may already have been popped by another thread, in which case the next
+         * index is stale, but the tag guarantees the swap below fails */
+        uint32_t next = atomic_load_explicit(&stack->nodes[index].next, memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(top, &old, tagged(next, (old >> 32) + 1),
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+/**
+ * @brief Create a new lock-free stack
+ *
+ * All of the stack's nodes are allocated up front, so pushing and popping never allocate.
+ *
+ * @param capacity The most values the stack can hold
+ *
+ * @return struct lockfree_stack* A pointer to the new stack, or NULL if allocation fails
+ */
+struct lockfree_stack *lockfree_stack_new(uint32_t capacity)
+{
+    if (capacity == 0 || capacity == UINT32_MAX) {
+        return NULL;
+    }
+
+    struct lockfree_stack *stack = aligned_alloc(_Alignof(struct lockfree_stack), sizeof(*stack));
+    if (!stack) {
+        return NULL;
+    }
+
+    stack->nodes = malloc(sizeof(struct lockfree_node) * ((size_t)capacity + 1));
+    if (!stack->nodes) {
+        free(stack);
+        return NULL;
+    }
+    stack->capacity = capacity;
+
+    /* Chain every node onto the free stack, lowest index on top */
+    for (uint32_t i = 1; i <= capacity; ++i) {
+        atomic_init(&stack->nodes[i].next, i < capacity ? i + 1 : LOCKFREE_STACK_NIL);
+    }
+    atomic_init(&stack->top, tagged(LOCKFREE_STACK_NIL, 0));
+    atomic_init(&stack->free, tagged(1, 0));
+
+    return stack;
+}
+
+/**
+ * @brief Free memory used by a lock-free stack
+ *
+ * No other thread may be using the stack.
+ *
+ * @param stack The stack to free
+ */
+void lockfree_stack_free(struct lockfree_stack *stack)
+{
+    if (!stack) {
+        return;
+    }
+
+    free(stack->nodes);
+    free(stack);
+}
+
+/**
+ * @brief Push a value onto a lock-free stack
+ *
+ * @param stack The stack to push onto
+ * @param data The value to push
+ *
+ * @return int 1 if the value was pushed, or 0 if the stack is full
+ */
+int lockfree_stack_push(struct lockfree_stack *stack, int data)
+{
+    uint32_t index = pop_index(stack, &stack->free);
+    if (index == LOCKFREE_STACK_NIL) {
+        return 0;
+    }
+
+    stack->nodes[index].data = data;
+    push_index(stack, &stack->top, index);
+
+    return 1;
+}
+
+/**
+ * @brief Pop the top value off a lock-free stack
+ *
+ * @param stack The stack to pop from
+ *
+ * @return int The value that was on top of the stack, or INT_MAX if the stack is empty
+ */
+int lockfree_stack_pop(struct lockfree_stack *stack)
+{
+    uint32_t index = pop_index(stack, &stack->top);
+    if (index == LOCKFREE_STACK_NIL) {
+        return INT_MAX;
+    }
+
+    int value = stack->nodes[index].data;
+    push_index(stack, &stack->free, index);
+
+    return value;
+}
+
+/**
+ * @brief Determine whether a lock-free stack is empty
+ *
+ * Other threads may change the stack at any time, so the answer can be out of date as soon as
+ * it is returned.
+ *
+ * @param stack The stack to check
+ *
+ * @return int 1 if the stack is empty, or 0 otherwise
+ */
+int lockfree_stack_empty(struct lockfree_stack *stack)
+{
+    return (uint32_t)atomic_load_explicit(&stack->top, memory_order_relaxed) ==
+           LOCKFREE_STACK_NIL;
+}
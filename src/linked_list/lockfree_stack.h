@@ -0,0 +1,46 @@
+/**
+ * @file lockfree_stack.h
+ * @author agent <agent@local>
+ * @brief A stack that any number of threads can push to and pop from without a lock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef LOCKFREE_STACK_H
+#define LOCKFREE_STACK_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+/** The index used in place of a NULL link. Slot 0 of the node array is never used. */
+#define LOCKFREE_STACK_NIL 0
+
+struct lockfree_node {
+    int data;               /** The value stored in the node. */
+    _Atomic(uint32_t) next; /** The index of the node below this one, or LOCKFREE_STACK_NIL. */
+};
+
+struct lockfree_stack {
+    _Alignas(64) _Atomic(uint64_t) top;       /** The top node's index, tagged with a count. */
+    _Alignas(64) _Atomic(uint64_t) free;      /** The top of the chain of unused nodes, tagged. */
+    _Alignas(64) struct lockfree_node *nodes; /** Every node, indexed from 1. */
+    uint32_t capacity;                        /** The most values the stack can hold. */
+};
+
+/** Create a new lock-free stack. */
+struct lockfree_stack *lockfree_stack_new(uint32_t capacity);
+/** Free memory used by a lock-free stack. */
+void lockfree_stack_free(struct lockfree_stack *stack);
+
+/** Push a value onto a lock-free stack. */
+int lockfree_stack_push(struct lockfree_stack *stack, int data);
+/** Pop the top value off a lock-free stack. */
+int lockfree_stack_pop(struct lockfree_stack *stack);
+
+/** Determine whether a lock-free stack is empty. */
+int lockfree_stack_empty(struct lockfree_stack *stack);
+
+#endif /* LOCKFREE_STACK_H */
@@ -0,0 +1,492 @@
+/**
+ * @file unrolled_list.c
+ * @author agent <agent@local>
+ * @brief An unrolled linked list that stores a cache line of values per node
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#include "./unrolled_list.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert(sizeof(struct unrolled_node) == 64, "a node should fill one cache line");
+
+/**
+ * @brief Create a new, empty list node
+ *
+ * @return struct unrolled_node* A new list node, or NULL if allocation fails
+ */
+static struct unrolled_node *unrolled_node_init(void)
+{
+    struct unrolled_node *new_node = malloc(sizeof(*new_node));
+    if (!new_node) {
+        return NULL;
+    }
+    new_node->next = NULL;
+    new_node->count = 0;
+
+    return new_node;
+}
+
+/**
+ * @brief Find the node holding the value at an index
+ *
+ * @param list The list to search, which must hold more than index values
+ * @param index The position in the list to search for
+ * @param prev Set to the node before the one returned, or NULL if it is the head
+ * @param offset Set to the position of the value within the returned node
+ *
+ * @return struct unrolled_node* The node holding the value
+ */
+static struct unrolled_node *find_node(struct unrolled_list *list, unsigned int index,
+                                       struct unrolled_node **prev, unsigned int *offset)
+{
+    struct unrolled_node *current = list->head;
+    *prev = NULL;
+
+    /* Whole nodes are skipped at once, so the walk is about 13 times shorter than a plain list */
+    while (index >= current->count) {
+        index -= current->count;
+        *prev = current;
+        current = current->next;
+    }
+    *offset = index;
+
+    return current;
+}
+
+/**
+ * @brief Remove a value from a node, unlinking or merging the node if it becomes sparse
+ *
+ * @param list The list that holds the node
+ * @param prev The node before node, or NULL if node is the head
+ * @param node The node to remove from
+ * @param offset The position of the value within the node
+ */
+static void erase_at(struct unrolled_list *list, struct unrolled_node *prev,
+                     struct unrolled_node *node, unsigned int offset)
+{
+    memmove(&node->data[offset], &node->data[offset + 1],
+            sizeof(node->data[0]) * (node->count - offset - 1));
+    --node->count;
+    --list->size;
+
+    if (node->count == 0) {
+        if (prev) {
+            prev->next = node->next;
+        }
+        else {
+            list->head = node->next;
+        }
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+        free(node);
+        return;
+    }
+
+    /* Keep nodes at least half full by pulling in the next node when both would fit in one */
+    struct unrolled_node *next = node->next;
+    if (next && node->count < UNROLLED_LIST_NODE_CAPACITY / 2 &&
+        node->count + next->count <= UNROLLED_LIST_NODE_CAPACITY) {
+        memcpy(&node->data[node->count], next->data, sizeof(next->data[0]) * next->count);
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        free(next);
+    }
+}
+
+/**
+ * @brief Create a new unrolled list
+ *
+ * @return struct unrolled_list* Pointer to the new list structure
+ */
+struct unrolled_list *unrolled_list_init()
+{
+    struct unrolled_list *list = malloc(sizeof(*list));
+    if (!list) {
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+
+    return list;
+}
+
+/**
+ * @brief Free the memory used by an unrolled list
+ *
+ * @param list The list to free memory from
+ */
+void unrolled_list_free(struct unrolled_list *list)
+{
+    if (!list) {
+        return;
+    }
+
+    struct unrolled_node *current = list->head;
+    while (current) {
+        list->head = current->next;
+        free(current);
+        current = list->head;
+    }
+    free(list);
+}
+
+/**
+ * @brief Get the current size of an unrolled list
+ *
+ * @param list The list to check
+ *
+ * @return unsigned int The current size of the given list
+ */
+unsigned int unrolled_list_size(struct unrolled_list *list)
+{
+    if (!list) {
+        return 0;
+    }
+    return list->size;
+}
+
+/**
+ * @brief Determine whether an unrolled list is empty
+ *
+ * @param list The list to check
+ *
+ * @return int 1 if the list is empty, or 0 otherwise
+ */
+int unrolled_list_empty(struct unrolled_list *list)
+{
+    return (!list || list->size == 0);
+}
+
+/**
+ * @brief Get the value stored at a specific location in a list
+ *
+ * @param list The list to check
+ * @param index The position in the list to search for
+ *
+ * @return int The value stored at the index, or INT_MAX if the index is out of bounds
+ */
+int unrolled_list_value_at(struct unrolled_list *list, unsigned int index)
+{
+    if (!list || index >= list->size) {
+        return INT_MAX;
+    }
+
+    struct unrolled_node *prev;
+    unsigned int offset;
+    struct unrolled_node *node = find_node(list, index, &prev, &offset);
+
+    return node->data[offset];
+}
+
+/**
+ * @brief Get the value of the item at the nth position from the end of a list
+ *
+ * @param list The list to query
+ * @param n The position to check
+ *
+ * @return int The value at the position, or INT_MAX if no such item exists
+ */
+int unrolled_list_value_n_from_end(struct unrolled_list *list, unsigned int n)
+{
+    if (unrolled_list_empty(list) || n >= list->size) {
+        return INT_MAX;
+    }
+
+    return unrolled_list_value_at(list, list->size - n - 1);
+}
+
+/**
+ * @brief Add an item to the front of a list
+ *
+ * @param list The list to add to
+ * @param data The item to add to the list
+ */
+void unrolled_list_push_front(struct unrolled_list *list, int data)
+{
+    if (!list) {
+        return;
+    }
+
+    struct unrolled_node *head = list->head;
+
+    if (!head || head->count == UNROLLED_LIST_NODE_CAPACITY) {
+        head = unrolled_node_init();
+        if (!head) {
+            return;
+        }
+        head->next = list->head;
+        list->head = head;
+        if (!list->tail) {
+            list->tail = head;
+        }
+    }
+
+    memmove(&head->data[1], &head->data[0], sizeof(head->data[0]) * head->count);
+    head->data[0] = data;
+    ++head->count;
+    ++list->size;
+}
+
+/**
+ * @brief Remove the first item in a list and return its value
+ *
+ * @param list The list to pop from
+ *
+ * @return int The value of the first item in the list, or INT_MAX if the list is empty
+ */
+int unrolled_list_pop_front(struct unrolled_list *list)
+{
+    if (unrolled_list_empty(list)) {
+        return INT_MAX;
+    }
+
+    int value = list->head->data[0];
+    erase_at(list, NULL, list->head, 0);
+
+    return value;
+}
+
+/**
+ * @brief Add an item to the end of a list
+ *
+ * @param list The list to append to
+ * @param data The value to add to the list
+ */
+void unrolled_list_push_back(struct unrolled_list *list, int data)
+{
+    if (!list) {
+        return;
+    }
+
+    struct unrolled_node *tail = list->tail;
+
+    if (!tail || tail->count == UNROLLED_LIST_NODE_CAPACITY) {
+        tail = unrolled_node_init();
+        if (!tail) {
+            return;
+        }
+        if (list->tail) {
+            list->tail->next = tail;
+        }
+        else {
+            list->head = tail;
+        }
+        list->tail = tail;
+    }
+
+    tail->data[tail->count++] = data;
+    ++list->size;
+}
+
+/**
+ * @brief Remove the last item in a list and return its value
+ *
+ * Only emptying the last node requires a walk to find the node before it, so on average the
+ * walk happens once every 13 pops.
+ *
+ * @param list The list to pop from
+ *
+ * @return int The value of the last item in the list, or INT_MAX if the list is empty
+ */
+int unrolled_list_pop_back(struct unrolled_list *list)
+{
+    if (unrolled_list_empty(list)) {
+        return INT_MAX;
+    }
+
+    struct unrolled_node *tail = list->tail;
+    int value = tail->data[--tail->count];
+    --list->size;
+
+    if (tail->count == 0) {
+        struct unrolled_node *prev = NULL;
+
+        if (list->head != tail) {
+            prev = list->head;
+            while (prev->next != tail) {
+                prev = prev->next;
+            }
+            prev->next = NULL;
+        }
+        else {
+            list->head = NULL;
+        }
+        list->tail = prev;
+        free(tail);
+    }
+
+    return value;
+}
+
+/**
+ * @brief Get the value of the first item in a list
+ *
+ * @param list The list to query
+ *
+ * @return int The value of the first item in the list, or INT_MAX if no such item exists
+ */
+int unrolled_list_front(struct unrolled_list *list)
+{
+    if (unrolled_list_empty(list)) {
+        return INT_MAX;
+    }
+
+    return list->head->data[0];
+}
+
+/**
+ * @brief Get the value of the last item in a list
+ *
+ * @param list The list to query
+ *
+ * @return int The value of the last item in the list, or INT_MAX if no such item exists
+ */
+int unrolled_list_back(struct unrolled_list *list)
+{
+    if (unrolled_list_empty(list)) {
+        return INT_MAX;
+    }
+
+    return list->tail->data[list->tail->count - 1];
+}
+
+/**
+ * @brief Insert an item at a specific index in a list
+ *
+ * As with linked_list_insert, the index must refer to an existing item, which is moved back
+ * by one position.
+ *
+ * @param list The list to insert into
+ * @param index The position in the list to insert into
+ * @param data The value to insert into the list
+ */
+void unrolled_list_insert(struct unrolled_list *list, unsigned int index, int data)
+{
+    if (unrolled_list_empty(list) || index >= list->size) {
+        return;
+    }
+
+    struct unrolled_node *prev;
+    unsigned int offset;
+    struct unrolled_node *node = find_node(list, index, &prev, &offset);
+
+    if (node->count == UNROLLED_LIST_NODE_CAPACITY) {
+        /* Split the full node, moving its upper half into a new node after it */
+        struct unrolled_node *half = unrolled_node_init();
+        if (!half) {
+            return;
+        }
+
+        unsigned int keep = UNROLLED_LIST_NODE_CAPACITY / 2;
+        half->count = node->count - keep;
+        memcpy(half->data, &node->data[keep], sizeof(node->data[0]) * half->count);
+        node->count = keep;
+        half->next = node->next;
+        node->next = half;
+        if (list->tail == node) {
+            list->tail = half;
+        }
+
+        if (offset > keep) {
+            offset -= keep;
+            node = half;
+        }
+    }
+
+    memmove(&node->data[offset + 1], &node->data[offset],
+            sizeof(node->data[0]) * (node->count - offset));
+    node->data[offset] = data;
+    ++node->count;
+    ++list->size;
+}
+
+/**
+ * @brief Remove an item at a specific index in a list
+ *
+ * @param list The list to erase from
+ * @param index The position in the list to erase
+ */
+void unrolled_list_erase(struct unrolled_list *list, unsigned int index)
+{
+    if (unrolled_list_empty(list) || index >= list->size) {
+        return;
+    }
+
+    struct unrolled_node *prev;
+    unsigned int offset;
+    struct unrolled_node *node = find_node(list, index, &prev, &offset);
+
+    erase_at(list, prev, node, offset);
+}
+
+/**
+ * @brief Remove the first occurrance of a given value from a list
+ *
+ * @param list The list to remove from
+ * @param value The value to remove
+ */
+void unrolled_list_remove_value(struct unrolled_list *list, int value)
+{
+    if (unrolled_list_empty(list)) {
+        return;
+    }
+
+    struct unrolled_node *prev = NULL;
+    struct unrolled_node *current = list->head;
+
+    while (current) {
+        for (unsigned int i = 0; i < current->count; ++i) {
+            if (current->data[i] == value) {
+                erase_at(list, prev, current, i);
+                return;
+            }
+        }
+        prev = current;
+        current = current->next;
+    }
+}
+
+/**
+ * @brief Reverse a list
+ *
+ * @param list The list to reverse
+ */
+void unrolled_list_reverse(struct unrolled_list *list)
+{
+    if (unrolled_list_empty(list) || list->size == 1) {
+        return;
+    }
+
+    struct unrolled_node *prev = NULL;
+    struct unrolled_node *current = list->head;
+    struct unrolled_node *next = NULL;
+
+    list->tail = list->head;
+    while (current) {
+        for (unsigned int i = 0, j = current->count - 1; i < j; ++i, --j) {
+            int tmp = current->data[i];
+            current->data[i] = current->data[j];
+            current->data[j] = tmp;
+        }
+
+        next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+    }
+    list->head = prev;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file unrolled_list.h
+ * @author agent <agent@local>
+ * @brief An unrolled linked list that stores a cache line of values per node
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+/** Values per node, chosen so that a node fills exactly one 64-byte cache line. */
+#define UNROLLED_LIST_NODE_CAPACITY 13
+
+struct unrolled_node {
+    struct unrolled_node *next;             /** The next node in the list, or NULL. */
+    unsigned int count;                     /** The number of values stored in this node. */
+    int data[UNROLLED_LIST_NODE_CAPACITY];  /** The values, packed at the start of the array. */
+};
+
+struct unrolled_list {
+    struct unrolled_node *head;
+    struct unrolled_node *tail;
+    unsigned int size;
+};
+
+/** Create a new unrolled list */
+struct unrolled_list *unrolled_list_init();
+
+/** Free memory used by an unrolled list */
+void unrolled_list_free(struct unrolled_list *list);
+
+/** Get the current size of an unrolled list */
+unsigned int unrolled_list_size(struct unrolled_list *list);
+
+/** Determine whether an unrolled list is empty */
+int unrolled_list_empty(struct unrolled_list *list);
+
+/** Get the value stored at a specific location in a list */
+int unrolled_list_value_at(struct unrolled_list *list, unsigned int index);
+
+/** Get the value of the item at the nth position from the end of a list */
+int unrolled_list_value_n_from_end(struct unrolled_list *list, unsigned int n);
+
+/** Add an item to the front of a list */
+void unrolled_list_push_front(struct unrolled_list *list, int data);
+
+/** Remove the first item in a list and return its value */
+int unrolled_list_pop_front(struct unrolled_list *list);
+
+/** Add an item to the end of a list */
+void unrolled_list_push_back(struct unrolled_list *list, int data);
+
+/** Remove the last item in a list and return its value */
+int unrolled_list_pop_back(struct unrolled_list *list);
+
+/** Get the value of the first item in a list */
+int unrolled_list_front(struct unrolled_list *list);
+
+/** Get the value of the last item in a list */
+int unrolled_list_back(struct unrolled_list *list);
+
+/** Insert an item at a specific index in a list */
+void unrolled_list_insert(struct unrolled_list *list, unsigned int index, int data);
+
+/** Remove an item at a specific index in a list */
+void unrolled_list_erase(struct unrolled_list *list, unsigned int index);
+
+/** Remove the first occurrance of a given value from a list */
+void unrolled_list_remove_value(struct unrolled_list *list, int value);
+
+/** Reverse a list */
+void unrolled_list_reverse(struct unrolled_list *list);
+
+#endif /* UNROLLED_LIST_H */
@@ -0,0 +1,199 @@
+/**
+ * @file event_queue.c
+ * @author agent <agent@local>
+ * @brief A thread-safe queue that can wake a consumer through an eventfd
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * A consumer running an event loop adds the queue's eventfd to its epoll set. The descriptor
+ * becomes readable when the queue goes from empty to non-empty, and the consumer then dequeues
+ * until event_queue_try_dequeue fails. That failure is what resets the descriptor, so as long as
+ * consumers always drain the queue, no wakeup is lost.
+ *
+ * Notifications are coalesced. Only the enqueue that finds the queue un-notified writes to the
+ * eventfd, and only the dequeue that finds the queue empty reads it, so a burst of items costs
+ * two system calls in total. Both happen under the lock, which keeps the descriptor readable
+ * exactly while notified is set.
+ *
+ * This file uses eventfd and is only built on Linux.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "event_queue.h"
+
+/**
+ * @brief Create a new event queue
+ *
+ * @param capacity The number of items the queue should hold before it needs to grow
+ *
+ * @return struct event_queue* A pointer to the new queue, or NULL if it could not be created
+ */
+struct event_queue *event_queue_new(int capacity)
+{
+    struct event_queue *queue = malloc(sizeof(*queue));
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->items = queue_arr_new(capacity);
+    if (!queue->items) {
+        free(queue);
+        return NULL;
+    }
+
+    queue->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (queue->fd < 0) {
+        queue_arr_free(queue->items);
+        free(queue);
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&queue->lock, NULL) != 0) {
+        close(queue->fd);
+        queue_arr_free(queue->items);
+        free(queue);
+        return NULL;
+    }
+    if (pthread_cond_init(&queue->not_empty, NULL) != 0) {
+        pthread_mutex_destroy(&queue->lock);
+        close(queue->fd);
+        queue_arr_free(queue->items);
+        free(queue);
+        return NULL;
+    }
+    queue->waiting = 0;
+    queue->notified = 0;
+
+    return queue;
+}
+
+/**
+ * @brief Free memory used by an event queue and close its eventfd
+ *
+ * No other thread may be using the queue, and the eventfd should be removed from any epoll set
+ * first.
+ *
+ * @param queue The queue to free
+ */
+void event_queue_free(struct event_queue *queue)
+{
+    if (!queue) {
+        return;
+    }
+
+    close(queue->fd);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_mutex_destroy(&queue->lock);
+    queue_arr_free(queue->items);
+    free(queue);
+}
+
+/**
+ * @brief Get the file descriptor to wait on for items
+ *
+ * The descriptor is readable while the queue may hold items. Do not read from it directly;
+ * drain the queue with event_queue_try_dequeue instead.
+ *
+ * @param queue The queue to wait on
+ *
+ * @return int The queue's eventfd
+ */
+int event_queue_fd(struct event_queue *queue)
+{
+    return queue->fd;
+}
+
+/**
+ * @brief Add an item to the end of a queue, waking a consumer if the queue was empty
+ *
+ * @param queue The queue to add to
+ * @param value The value of the item to add
+ *
+ * @return int 1 if the item was added, or 0 if the queue could not grow to hold it
+ */
+int event_queue_enqueue(struct event_queue *queue, int value)
+{
+    pthread_mutex_lock(&queue->lock);
+
+    if (!queue_arr_enqueue(queue->items, value)) {
+        pthread_mutex_unlock(&queue->lock);
+        return 0;
+    }
+
+    if (!queue->notified) {
+        uint64_t one = 1;
+        ssize_t written = write(queue->fd, &one, sizeof(one));
+        (void)written; /* The counter is at most 1, so the write cannot fail */
+        queue->notified = 1;
+    }
+    if (queue->waiting) {
+        pthread_cond_signal(&queue->not_empty);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return 1;
+}
+
+/**
+ * @brief Remove the item at the front of a queue, if there is one
+ *
+ * Finding the queue empty resets the eventfd, so an event loop should call this until it fails
+ * each time the descriptor becomes readable.
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ *
+ * @return int 1 if an item was removed, or 0 if the queue is empty
+ */
+int event_queue_try_dequeue(struct event_queue *queue, int *value)
+{
+    pthread_mutex_lock(&queue->lock);
+
+    if (queue_arr_empty(queue->items)) {
+        if (queue->notified) {
+            uint64_t count;
+            ssize_t drained = read(queue->fd, &count, sizeof(count));
+            (void)drained; /* The counter is known to be non-zero, so the read cannot fail */
+            queue->notified = 0;
+        }
+        pthread_mutex_unlock(&queue->lock);
+        return 0;
+    }
+
+    *value = queue_arr_dequeue(queue->items);
+    pthread_mutex_unlock(&queue->lock);
+
+    return 1;
+}
+
+/**
+ * @brief Remove the item at the front of a queue, waiting for one if necessary
+ *
+ * This is for consumers that are not running an event loop. It does not touch the eventfd.
+ *
+ * @param queue The queue to remove an item from
+ *
+ * @return int The value of the removed item
+ */
+int event_queue_dequeue(struct event_queue *queue)
+{
+    pthread_mutex_lock(&queue->lock);
+
+    ++queue->waiting;
+    while (queue_arr_empty(queue->items)) {
+        pthread_cond_wait(&queue->not_empty, &queue->lock);
+    }
+    --queue->waiting;
+
+    int value = queue_arr_dequeue(queue->items);
+    pthread_mutex_unlock(&queue->lock);
+
+    return value;
+}
@@ -0,0 +1,46 @@
+/**
+ * @file event_queue.h
+ * @author agent <agent@local>
+ * @brief A thread-safe queue that can wake a consumer through an eventfd
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <pthread.h>
+
+#include "queue_arr.h"
+
+struct event_queue {
+    struct queue_arr *items;  /** The queued items. */
+    pthread_mutex_t lock;     /** Protects every other field. */
+    pthread_cond_t not_empty; /** Signalled when an item is added while a thread is waiting. */
+    unsigned int waiting;     /** The number of threads blocked in event_queue_dequeue. */
+    int notified;             /** 1 if the eventfd has been signalled since the queue was empty. */
+    int fd;                   /** An eventfd that is readable while there may be items. */
+};
+
+/** Create a new event queue */
+struct event_queue *event_queue_new(int capacity);
+
+/** Free memory used by an event queue and close its eventfd */
+void event_queue_free(struct event_queue *queue);
+
+/** Get the file descriptor to wait on for items */
+int event_queue_fd(struct event_queue *queue);
+
+/** Add an item to the end of a queue, waking a consumer if the queue was empty */
+int event_queue_enqueue(struct event_queue *queue, int value);
+
+/** Remove the item at the front of a queue, if there is one */
+int event_queue_try_dequeue(struct event_queue *queue, int *value);
+
+/** Remove the item at the front of a queue, waiting for one if necessary */
+int event_queue_dequeue(struct event_queue *queue);
+
+#endif /* EVENT_QUEUE_H */
@@ -0,0 +1,554 @@
+/**
+ * @file mpmc_queue.c
+ * @author agent <agent@local>
+ * @brief A bounded queue that any number of threads can enqueue to and dequeue from
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * This is Dmitry Vyukov's bounded queue. Each slot has a sequence number that says whose turn
+ * it is. A slot at position pos is ready to be filled when its sequence is pos, and ready to be
+ * emptied when it is pos + 1. A producer claims a position by advancing enqueue_pos with
+ * compare-and-swap, fills the slot, and then hands it to consumers by storing pos + 1 with
+ * release order. A consumer claims, empties, and stores pos + capacity to hand the slot to the
+ * producer that will wrap around to it next. Producers and consumers only ever contend with
+ * their own kind, on separate cache lines.
+ *
+ * Threads that must wait sleep on a condition variable. To keep the fast path free of the mutex,
+ * a successful operation only takes the lock if a thread on the other side has announced that it
+ * is waiting. A full fence on both sides makes sure that either the sleeper sees the item (or
+ * room) or the waker sees the sleeper, so no wakeup is lost.
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "mpmc_queue.h"
+
+/** The smallest capacity a queue is created with. */
+#define MPMC_QUEUE_MIN_CAPACITY 2
+
+/** How many times a blocking call retries before going to sleep. */
+#define MPMC_QUEUE_SPIN_TRIES 64
+
+/**
+ * @brief Initialize the lock and condition variables a queue blocks on
+ *
+ * @param queue The queue to initialize
+ *
+ * @return int 1 on success, or 0 if any of them could not be initialized, in which case none
+ *         are left to destroy
+ */
+static int mpmc_queue_init_sync(struct mpmc_queue *queue)
+{
+    pthread_condattr_t attr;
+    int initialized = 0;
+
+    if (pthread_condattr_init(&attr) != 0) {
+        return 0;
+    }
+
+    /* Wait with the monotonic clock so timeouts are not affected by changes to the time of day */
+    if (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) == 0 &&
+        pthread_mutex_init(&queue->lock, NULL) == 0) {
+        if (pthread_cond_init(&queue->not_full, &attr) == 0) {
+            if (pthread_cond_init(&queue->not_empty, &attr) == 0) {
+                initialized = 1;
+            }
+            else {
+                pthread_cond_destroy(&queue->not_full);
+            }
+        }
+        if (!initialized) {
+            pthread_mutex_destroy(&queue->lock);
+        }
+    }
+    pthread_condattr_destroy(&attr);
+
+    return initialized;
+}
+
+/**
+ * @brief Create a new multi-producer, multi-consumer queue
+ *
+ * @param capacity The most items the queue can hold, rounded up to a power of two
+ *
+ * @return struct mpmc_queue* A pointer to the new queue, or NULL if allocation fails
+ */
+struct mpmc_queue *mpmc_queue_new(int capacity)
+{
+    unsigned int rounded = MPMC_QUEUE_MIN_CAPACITY;
+    while (rounded < (unsigned int)capacity && rounded <= UINT_MAX / 4) {
+        rounded *= 2;
+    }
+
+    struct mpmc_queue *queue = aligned_alloc(_Alignof(struct mpmc_queue), sizeof(*queue));
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->slots = malloc(sizeof(struct mpmc_slot) * rounded);
+    if (!queue->slots) {
+        free(queue);
+        return NULL;
+    }
+
+    if (!mpmc_queue_init_sync(queue)) {
+        free(queue->slots);
+        free(queue);
+        return NULL;
+    }
+
+    for (unsigned int i = 0; i < rounded; ++i) {
+        atomic_init(&queue->slots[i].sequence, i);
+    }
+    queue->capacity = rounded;
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    atomic_init(&queue->producers_waiting, 0);
+    atomic_init(&queue->consumers_waiting, 0);
+
+    return queue;
+}
+
+/**
+ * @brief Free memory used by a multi-producer, multi-consumer queue
+ *
+ * No other thread may be using the queue.
+ *
+ * @param queue The queue to free
+ */
+void mpmc_queue_free(struct mpmc_queue *queue)
+{
+    if (!queue) {
+        return;
+    }
+
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue->slots);
+    free(queue);
+}
+
+/**
+ * @brief Wake the threads waiting on a condition, if there are any
+ *
+ * @param queue The queue the threads are waiting on
+ * @param waiting The number of threads waiting on the condition
+ * @param cond The condition to signal
+ */
+static void wake(struct mpmc_queue *queue, atomic_uint *waiting, pthread_cond_t *cond)
+{
+    /* Pairs with the fence in wait_for, after the waiter has announced itself */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiting, memory_order_relaxed) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    pthread_cond_broadcast(cond);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/**
+ * @brief Claim a slot and fill it, without waking anyone
+ *
+ * @param queue The queue to add to
+ * @param value The value of the item to add
+ *
+ * @return int 1 if the item was added, or 0 if the queue is full
+ */
+static int enqueue_once(struct mpmc_queue *queue, int value)
+{
+    unsigned int pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    struct mpmc_slot *slot;
+
+    for (;;) {
+        slot = &queue->slots[pos & (queue->capacity - 1)];
+        unsigned int sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int diff = (int)(sequence - pos);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            /* The slot still holds the item from the previous lap, so the queue is full */
+            return 0;
+        }
+        else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->data = value;
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * @brief Claim a filled slot and empty it, without waking anyone
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ *
+ * @return int 1 if an item was removed, or 0 if the queue is empty
+ */
+static int dequeue_once(struct mpmc_queue *queue, int *value)
+{
+    unsigned int pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    struct mpmc_slot *slot;
+
+    for (;;) {
+        slot = &queue->slots[pos & (queue->capacity - 1)];
+        unsigned int sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int diff = (int)(sequence - (pos + 1));
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            /* The slot has not been filled for this lap yet, so the queue is empty */
+            return 0;
+        }
+        else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    *value = slot->data;
+    atomic_store_explicit(&slot->sequence, pos + queue->capacity, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * @brief Add an item to the end of a queue, if there is room
+ *
+ * @param queue The queue to add to
+ * @param value The value of the item to add
+ *
+ * @return int 1 if the item was added, or 0 if the queue is full
+ */
+int mpmc_queue_try_enqueue(struct mpmc_queue *queue, int value)
+{
+    if (!enqueue_once(queue, value)) {
+        return 0;
+    }
+
+    wake(queue, &queue->consumers_waiting, &queue->not_empty);
+    return 1;
+}
+
+/**
+ * @brief Remove the item at the front of a queue, if there is one
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ *
+ * @return int 1 if an item was removed, or 0 if the queue is empty
+ */
+int mpmc_queue_try_dequeue(struct mpmc_queue *queue, int *value)
+{
+    if (!dequeue_once(queue, value)) {
+        return 0;
+    }
+
+    wake(queue, &queue->producers_waiting, &queue->not_full);
+    return 1;
+}
+
+/**
+ * @brief Claim a run of consecutive slots that are all ready for the same kind of operation
+ *
+ * A slot that is ready stays ready until its position is claimed, and positions are only
+ * claimed by advancing the shared counter, so once the compare-and-swap succeeds every slot in
+ * the run belongs to this thread.
+ *
+ * @param queue The queue to claim slots in
+ * @param counter The position counter for the operation, enqueue_pos or dequeue_pos
+ * @param ready How far ahead of its position a slot's sequence is when ready: 0 to fill, 1 to
+ *        empty
+ * @param max The most slots to claim
+ * @param count Set to the number of slots claimed
+ *
+ * @return unsigned int The position of the first claimed slot
+ */
+static unsigned int claim_run(struct mpmc_queue *queue, atomic_uint *counter, unsigned int ready,
+                              unsigned int max, unsigned int *count)
+{
+    unsigned int pos = atomic_load_explicit(counter, memory_order_relaxed);
+
+    *count = 0;
+    if (max == 0) {
+        return pos;
+    }
+
+    for (;;) {
+        unsigned int run = 0;
+        while (run < max) {
+            struct mpmc_slot *slot = &queue->slots[(pos + run) & (queue->capacity - 1)];
+            unsigned int sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+            if (sequence != pos + run + ready) {
+                break;
+            }
+            ++run;
+        }
+
+        /* The first slot not being ready could mean another thread got there first, or that the
+         * queue is full (or empty); only the latter is a reason to give up */
+        if (run == 0) {
+            struct mpmc_slot *slot = &queue->slots[pos & (queue->capacity - 1)];
+            unsigned int sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+            if ((int)(sequence - (pos + ready)) < 0) {
+                return pos;
+            }
+            pos = atomic_load_explicit(counter, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(counter, &pos, pos + run, memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            *count = run;
+            return pos;
+        }
+    }
+}
+
+/**
+ * @brief Add as many of several items to the end of a queue as there is room for
+ *
+ * The run of slots is claimed with a single compare-and-swap, and waiting consumers are woken
+ * at most once for the whole batch.
+ *
+ * @param queue The queue to add to
+ * @param values The items to add, in order
+ * @param count The number of items to add
+ *
+ * @return unsigned int The number of items added from the start of values
+ */
+unsigned int mpmc_queue_try_enqueue_batch(struct mpmc_queue *queue, const int *values,
+                                          unsigned int count)
+{
+    if (count > queue->capacity) {
+        count = queue->capacity;
+    }
+
+    unsigned int claimed;
+    unsigned int pos = claim_run(queue, &queue->enqueue_pos, 0, count, &claimed);
+
+    for (unsigned int i = 0; i < claimed; ++i) {
+        struct mpmc_slot *slot = &queue->slots[(pos + i) & (queue->capacity - 1)];
+        slot->data = values[i];
+        atomic_store_explicit(&slot->sequence, pos + i + 1, memory_order_release);
+    }
+
+    if (claimed) {
+        wake(queue, &queue->consumers_waiting, &queue->not_empty);
+    }
+    return claimed;
+}
+
+/**
+ * @brief Remove up to a given number of items from the front of a queue
+ *
+ * The run of slots is claimed with a single compare-and-swap, and waiting producers are woken
+ * at most once for the whole batch.
+ *
+ * @param queue The queue to remove items from
+ * @param values Set to the removed items, in order
+ * @param max The most items to remove
+ *
+ * @return unsigned int The number of items removed
+ */
+unsigned int mpmc_queue_try_dequeue_batch(struct mpmc_queue *queue, int *values,
+                                          unsigned int max)
+{
+    if (max > queue->capacity) {
+        max = queue->capacity;
+    }
+
+    unsigned int claimed;
+    unsigned int pos = claim_run(queue, &queue->dequeue_pos, 1, max, &claimed);
+
+    for (unsigned int i = 0; i < claimed; ++i) {
+        struct mpmc_slot *slot = &queue->slots[(pos + i) & (queue->capacity - 1)];
+        values[i] = slot->data;
+        atomic_store_explicit(&slot->sequence, pos + i + queue->capacity, memory_order_release);
+    }
+
+    if (claimed) {
+        wake(queue, &queue->producers_waiting, &queue->not_full);
+    }
+    return claimed;
+}
+
+/**
+ * @brief Retry an enqueue or dequeue until it succeeds, sleeping between attempts
+ *
+ * @param queue The queue to operate on
+ * @param dequeue 1 to dequeue into value, or 0 to enqueue the value it points to
+ * @param value The item to enqueue, or where to store the dequeued item
+ * @param deadline When to give up, on the monotonic clock, or NULL to wait forever
+ *
+ * @return int 1 if the operation succeeded, or 0 if the deadline passed first
+ */
+static int wait_for(struct mpmc_queue *queue, int dequeue, int *value,
+                    const struct timespec *deadline)
+{
+    atomic_uint *waiting = dequeue ? &queue->consumers_waiting : &queue->producers_waiting;
+    pthread_cond_t *cond = dequeue ? &queue->not_empty : &queue->not_full;
+
+    for (int i = 0; i < MPMC_QUEUE_SPIN_TRIES; ++i) {
+        if (dequeue ? mpmc_queue_try_dequeue(queue, value)
+                    : mpmc_queue_try_enqueue(queue, *value)) {
+            return 1;
+        }
+    }
+
+    int done = 0;
+    int timed_out = 0;
+
+    pthread_mutex_lock(&queue->lock);
+    atomic_fetch_add_explicit(waiting, 1, memory_order_relaxed);
+    while (!done && !timed_out) {
+        /* Pairs with the fence in wake, so a concurrent waker either sees us or we see its work */
+        atomic_thread_fence(memory_order_seq_cst);
+        done = dequeue ? dequeue_once(queue, value) : enqueue_once(queue, *value);
+        if (done) {
+            break;
+        }
+
+        if (deadline) {
+            timed_out = pthread_cond_timedwait(cond, &queue->lock, deadline) == ETIMEDOUT;
+        }
+        else {
+            pthread_cond_wait(cond, &queue->lock);
+        }
+    }
+    if (!done) {
+        done = dequeue ? dequeue_once(queue, value) : enqueue_once(queue, *value);
+    }
+    atomic_fetch_sub_explicit(waiting, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->lock);
+
+    /* Our success may be what a thread on the other side is waiting for */
+    if (done) {
+        if (dequeue) {
+            wake(queue, &queue->producers_waiting, &queue->not_full);
+        }
+        else {
+            wake(queue, &queue->consumers_waiting, &queue->not_empty);
+        }
+    }
+
+    return done;
+}
+
+/**
+ * @brief Work out when a timeout ends
+ *
+ * @param deadline Set to the time, on the monotonic clock, that is timeout_ms from now
+ * @param timeout_ms The length of the timeout in milliseconds
+ */
+static void deadline_after(struct timespec *deadline, unsigned int timeout_ms)
+{
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += timeout_ms / 1000;
+    deadline->tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline->tv_nsec >= 1000000000) {
+        deadline->tv_nsec -= 1000000000;
+        ++deadline->tv_sec;
+    }
+}
+
+/**
+ * @brief Add an item to the end of a queue, waiting for room if necessary
+ *
+ * @param queue The queue to add to
+ * @param value The value of the item to add
+ */
+void mpmc_queue_enqueue(struct mpmc_queue *queue, int value)
+{
+    wait_for(queue, 0, &value, NULL);
+}
+
+/**
+ * @brief Remove the item at the front of a queue, waiting for one if necessary
+ *
+ * @param queue The queue to remove an item from
+ *
+ * @return int The value of the removed item
+ */
+int mpmc_queue_dequeue(struct mpmc_queue *queue)
+{
+    int value;
+    wait_for(queue, 1, &value, NULL);
+
+    return value;
+}
+
+/**
+ * @brief Add an item to the end of a queue, waiting a limited time for room
+ *
+ * @param queue The queue to add to
+ * @param value The value of the item to add
+ * @param timeout_ms The longest time to wait, in milliseconds
+ *
+ * @return int 1 if the item was added, or 0 if the queue stayed full until the timeout
+ */
+int mpmc_queue_timed_enqueue(struct mpmc_queue *queue, int value, unsigned int timeout_ms)
+{
+    struct timespec deadline;
+    deadline_after(&deadline, timeout_ms);
+
+    return wait_for(queue, 0, &value, &deadline);
+}
+
+/**
+ * @brief Remove the item at the front of a queue, waiting a limited time for one
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ * @param timeout_ms The longest time to wait, in milliseconds
+ *
+ * @return int 1 if an item was removed, or 0 if the queue stayed empty until the timeout
+ */
+int mpmc_queue_timed_dequeue(struct mpmc_queue *queue, int *value, unsigned int timeout_ms)
+{
+    struct timespec deadline;
+    deadline_after(&deadline, timeout_ms);
+
+    return wait_for(queue, 1, value, &deadline);
+}
+
+/**
+ * @brief Get the number of items in a queue
+ *
+ * Other threads may change the queue at any time, so the answer can be out of date as soon as
+ * it is returned. Items that are being enqueued or dequeued are counted.
+ *
+ * @param queue The queue to check
+ *
+ * @return unsigned int The number of items in the queue
+ */
+unsigned int mpmc_queue_size(struct mpmc_queue *queue)
+{
+    unsigned int dequeued = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    unsigned int enqueued = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    int size = (int)(enqueued - dequeued);
+
+    return size < 0 ? 0 : (unsigned int)size;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file mpmc_queue.h
+ * @author agent <agent@local>
+ * @brief A bounded queue that any number of threads can enqueue to and dequeue from
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+struct mpmc_slot {
+    atomic_uint sequence; /** Says whether the slot is ready to be filled or to be emptied. */
+    int data;             /** The item stored in the slot. */
+};
+
+struct mpmc_queue {
+    _Alignas(64) atomic_uint enqueue_pos;  /** The number of items enqueued so far. */
+    _Alignas(64) atomic_uint dequeue_pos;  /** The number of items dequeued so far. */
+
+    _Alignas(64) struct mpmc_slot *slots;  /** A ring buffer of slots. */
+    unsigned int capacity;                 /** The number of slots, always a power of two. */
+
+    _Alignas(64) atomic_uint producers_waiting; /** Producers asleep until there is room. */
+    atomic_uint consumers_waiting;         /** Consumers asleep until there is an item. */
+    pthread_mutex_t lock;                  /** Protects sleeping, never the queue itself. */
+    pthread_cond_t not_full;               /** Signalled when an item is dequeued. */
+    pthread_cond_t not_empty;              /** Signalled when an item is enqueued. */
+};
+
+/** Create a new multi-producer, multi-consumer queue */
+struct mpmc_queue *mpmc_queue_new(int capacity);
+
+/** Free memory used by a multi-producer, multi-consumer queue */
+void mpmc_queue_free(struct mpmc_queue *queue);
+
+/** Add an item to the end of a queue, if there is room */
+int mpmc_queue_try_enqueue(struct mpmc_queue *queue, int value);
+
+/** Remove the item at the front of a queue, if there is one */
+int mpmc_queue_try_dequeue(struct mpmc_queue *queue, int *value);
+
+/** Add as many of several items to the end of a queue as there is room for */
+unsigned int mpmc_queue_try_enqueue_batch(struct mpmc_queue *queue, const int *values,
+                                          unsigned int count);
+
+/** Remove up to a given number of items from the front of a queue */
+unsigned int mpmc_queue_try_dequeue_batch(struct mpmc_queue *queue, int *values,
+                                          unsigned int max);
+
+/** Add an item to the end of a queue, waiting for room if necessary */
+void mpmc_queue_enqueue(struct mpmc_queue *queue, int value);
+
+/** Remove the item at the front of a queue, waiting for one if necessary */
+int mpmc_queue_dequeue(struct mpmc_queue *queue);
+
+/** Add an item to the end of a queue, waiting a limited time for room */
+int mpmc_queue_timed_enqueue(struct mpmc_queue *queue, int value, unsigned int timeout_ms);
+
+/** Remove the item at the front of a queue, waiting a limited time for one */
+int mpmc_queue_timed_dequeue(struct mpmc_queue *queue, int *value, unsigned int timeout_ms);
+
+/** Get the number of items in a queue */
+unsigned int mpmc_queue_size(struct mpmc_queue *queue);
+
+#endif /* MPMC_QUEUE_H */
@@ -9,25 +9,46 @@
  *
  */
 
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "queue_arr.h"
 
+/** The smallest capacity a queue is created with. */
+#define QUEUE_ARR_MIN_CAPACITY 4
+
 /**
  * @brief Create a new queue
  *
- * @param capacity The maximum size of the queue
+ * The capacity is rounded up to a power of two, so that indices can wrap around the buffer with
+ * a mask instead of a division. The queue grows when it fills up.
+ *
+ * @param capacity The number of items the queue should hold before it needs to grow
  *
- * @return struct queue_arr* A pointer to the new queue struct
+ * @return struct queue_arr* A pointer to the new queue struct, or NULL if allocation fails
  */
 struct queue_arr *queue_arr_new(int capacity)
 {
+    unsigned int rounded = QUEUE_ARR_MIN_CAPACITY;
+    while (rounded < (unsigned int)capacity && rounded <= UINT_MAX / 2) {
+        rounded *= 2;
+    }
+
     struct queue_arr *queue = malloc(sizeof(struct queue_arr));
-    queue->data = malloc(sizeof(int) * capacity);
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->data = malloc(sizeof(int) * rounded);
+    if (!queue->data) {
+        free(queue);
+        return NULL;
+    }
     queue->head = 0;
     queue->tail = 0;
     queue->size = 0;
-    queue->capacity = capacity;
+    queue->capacity = rounded;
 
     return queue;
 }
@@ -39,25 +60,191 @@ struct queue_arr *queue_arr_new(int capacity)
  */
 void queue_arr_free(struct queue_arr *queue)
 {
+    if (!queue) {
+        return;
+    }
+
     free(queue->data);
     free(queue);
 }
 
 /**
- * @brief Add an item to the queue
+ * @brief Grow a queue's buffer so that it holds at least a given number of items
+ *
+ * The new capacity is the smallest power of two that is at least needed, and the buffer is
+ * reallocated once. Any items that had wrapped around to the start of the old buffer are then
+ * moved to just past its old end, so the queue's contents are contiguous again (modulo the new
+ * capacity).
+ *
+ * @param queue The queue to grow
+ * @param needed The number of items the queue must be able to hold, more than its capacity
+ *
+ * @return int 1 if the queue grew, or 0 if allocation failed or needed has no power of two to
+ *         round up to
+ */
+static int queue_arr_grow(struct queue_arr *queue, unsigned int needed)
+{
+    unsigned int old_capacity = queue->capacity;
+    unsigned int capacity = old_capacity;
+    while (capacity < needed) {
+        if (capacity > UINT_MAX / 2) {
+            return 0;
+        }
+        capacity *= 2;
+    }
+
+    int *data = realloc(queue->data, sizeof(int) * capacity);
+    if (!data) {
+        return 0;
+    }
+    queue->data = data;
+    queue->capacity = capacity;
+
+    /* The items in [head, old_capacity) are followed by any that wrapped around into [0, end).
+     * At least doubling the buffer leaves room for the wrapped part right after the old end. */
+    if (queue->head + queue->size > old_capacity) {
+        unsigned int wrapped = queue->head + queue->size - old_capacity;
+        memcpy(&queue->data[old_capacity], queue->data, sizeof(int) * wrapped);
+    }
+    queue->tail = (queue->head + queue->size) & (queue->capacity - 1);
+
+    return 1;
+}
+
+/**
+ * @brief Add an item to the end of a queue
  *
  * @param queue The queue to add to
  * @param value The value of the item to add
+ *
+ * @return int 1 if the item was added, or 0 if the queue was full and could not grow
  */
-void queue_arr_enqueue(struct queue_arr *queue, int value)
+int queue_arr_enqueue(struct queue_arr *queue, int value)
 {
-    queue->data[queue->tail++] = value;
-    queue->tail %= queue->capacity;
+    if (!queue) {
+        return 0;
+    }
+    if (queue->size == queue->capacity && !queue_arr_grow(queue, queue->size + 1)) {
+        return 0;
+    }
+
+    queue->data[queue->tail] = value;
+    queue->tail = (queue->tail + 1) & (queue->capacity - 1);
+    ++queue->size;
+
+    return 1;
 }
 
+/**
+ * @brief Remove an item from the front of a queue and return it
+ *
+ * @param queue The queue to remove an item from
+ *
+ * @return int The value of the first item in the queue, or INT_MAX if the queue is empty
+ */
 int queue_arr_dequeue(struct queue_arr *queue)
 {
-    int value = queue->data[queue->head++];
-    queue->head %= queue->capacity;
+    if (queue_arr_empty(queue)) {
+        return INT_MAX;
+    }
+
+    int value = queue->data[queue->head];
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    --queue->size;
+
     return value;
 }
+
+/**
+ * @brief Add several items to the end of a queue
+ *
+ * The queue grows at most once, to fit all of the items, and they are copied in with at most two
+ * calls to memcpy: one up to the end of the buffer and one for any part that wraps around.
+ *
+ * @param queue The queue to add to
+ * @param values The items to add, in order
+ * @param count The number of items to add
+ *
+ * @return unsigned int The number of items added, which is count, or 0 if the queue could not
+ *         grow enough to hold them
+ */
+unsigned int queue_arr_enqueue_batch(struct queue_arr *queue, const int *values,
+                                     unsigned int count)
+{
+    if (!queue || count > UINT_MAX - queue->size) {
+        return 0;
+    }
+    if (queue->size + count > queue->capacity && !queue_arr_grow(queue, queue->size + count)) {
+        return 0;
+    }
+
+    unsigned int first = queue->capacity - queue->tail;
+    if (first > count) {
+        first = count;
+    }
+    memcpy(&queue->data[queue->tail], values, sizeof(int) * first);
+    memcpy(queue->data, &values[first], sizeof(int) * (count - first));
+
+    queue->tail = (queue->tail + count) & (queue->capacity - 1);
+    queue->size += count;
+
+    return count;
+}
+
+/**
+ * @brief Remove up to a given number of items from the front of a queue
+ *
+ * The items are copied out with at most two calls to memcpy.
+ *
+ * @param queue The queue to remove items from
+ * @param values Set to the removed items, in order
+ * @param max The most items to remove
+ *
+ * @return unsigned int The number of items removed
+ */
+unsigned int queue_arr_dequeue_batch(struct queue_arr *queue, int *values, unsigned int max)
+{
+    if (queue_arr_empty(queue)) {
+        return 0;
+    }
+
+    unsigned int count = queue->size < max ? queue->size : max;
+    unsigned int first = queue->capacity - queue->head;
+    if (first > count) {
+        first = count;
+    }
+    memcpy(values, &queue->data[queue->head], sizeof(int) * first);
+    memcpy(&values[first], queue->data, sizeof(int) * (count - first));
+
+    queue->head = (queue->head + count) & (queue->capacity - 1);
+    queue->size -= count;
+
+    return count;
+}
+
+/**
+ * @brief Get the number of items in a queue
+ *
+ * @param queue The queue to check
+ *
+ * @return unsigned int The number of items in the queue
+ */
+unsigned int queue_arr_size(struct queue_arr *queue)
+{
+    if (!queue) {
+        return 0;
+    }
+    return queue->size;
+}
+
+/**
+ * @brief Check whether a queue is empty
+ *
+ * @param queue The queue to check
+ *
+ * @return int 1 if the queue is empty, or 0 otherwise
+ */
+int queue_arr_empty(struct queue_arr *queue)
+{
+    return (!queue || queue->size == 0);
+}
@@ -9,18 +9,40 @@
  *
  */
 
+#ifndef QUEUE_ARR_H
+#define QUEUE_ARR_H
+
 struct queue_arr {
-    int *data;
-    int head;
-    int tail;
-    int size;
-    int capacity;
+    int *data;             /** A ring buffer holding the queue's items. */
+    unsigned int head;     /** The index of the first item. */
+    unsigned int tail;     /** The index one past the last item. */
+    unsigned int size;     /** The number of items in the queue. */
+    unsigned int capacity; /** The length of data, always a power of two. */
 };
 
+/** Create a new queue */
 struct queue_arr *queue_arr_new(int capacity);
 
+/** Free memory used by a queue */
 void queue_arr_free(struct queue_arr *queue);
 
-void queue_arr_enqueue(struct queue_arr *queue, int value);
+/** Add an item to the end of a queue */
+int queue_arr_enqueue(struct queue_arr *queue, int value);
 
+/** Remove an item from the front of a queue and return it */
 int queue_arr_dequeue(struct queue_arr *queue);
+
+/** Add several items to the end of a queue */
+unsigned int queue_arr_enqueue_batch(struct queue_arr *queue, const int *values,
+                                     unsigned int count);
+
+/** Remove up to a given number of items from the front of a queue */
+unsigned int queue_arr_dequeue_batch(struct queue_arr *queue, int *values, unsigned int max);
+
+/** Get the number of items in a queue */
+unsigned int queue_arr_size(struct queue_arr *queue);
+
+/** Check whether a queue is empty */
+int queue_arr_empty(struct queue_arr *queue);
+
+#endif /* QUEUE_ARR_H */
@@ -28,6 +28,13 @@ struct queue_ll* queue_ll_init()
 
     queue->head = NULL;
     queue->tail = NULL;
+    queue->size = 0;
+    queue->high_watermark = 0;
+    queue->low_watermark = 0;
+    queue->on_high = NULL;
+    queue->on_low = NULL;
+    queue->watermark_context = NULL;
+    queue->above_high = 0;
 
     return queue;
 }
@@ -53,6 +60,36 @@ void queue_ll_free(struct queue_ll* queue)
     free(queue);
 }
 
+/**
+ * @brief Call the queue's watermark callbacks if its size has crossed a watermark
+ *
+ * The callbacks alternate: on_high is called once when the size reaches the high watermark, and
+ * not again until on_low has been called because the size fell to the low watermark. A gap
+ * between the two keeps a queue whose size hovers around one of them from calling back on every
+ * operation.
+ *
+ * @param queue The queue whose size just changed
+ */
+static void check_watermarks(struct queue_ll* queue)
+{
+    if (queue->high_watermark == 0) {
+        return;
+    }
+
+    if (!queue->above_high && queue->size >= queue->high_watermark) {
+        queue->above_high = 1;
+        if (queue->on_high) {
+            queue->on_high(queue, queue->watermark_context);
+        }
+    }
+    else if (queue->above_high && queue->size <= queue->low_watermark) {
+        queue->above_high = 0;
+        if (queue->on_low) {
+            queue->on_low(queue, queue->watermark_context);
+        }
+    }
+}
+
 /**
  * @brief Add an item to the end of a queue
  *
@@ -66,6 +103,9 @@ void queue_ll_enqueue(struct queue_ll* queue, int data)
     }
 
     struct node* new_node = malloc(sizeof(*new_node));
+    if (!new_node) {
+        return;
+    }
     new_node->data = data;
     new_node->next = NULL;
 
@@ -77,28 +117,142 @@ void queue_ll_enqueue(struct queue_ll* queue, int data)
         queue->tail->next = new_node;
         queue->tail = new_node;
     }
+    ++queue->size;
+    check_watermarks(queue);
 }
 
 /**
  * @brief Remove an item from the front of a queue and return it
  *
+ * Since INT_MAX is also returned when the queue is empty, use queue_ll_try_dequeue if the queue
+ * may hold INT_MAX.
+ *
  * @param queue The queue to remove an item from
  *
  * @return int The value of the first item in the queue, or INT_MAX if the queue is empty
  */
 int queue_ll_dequeue(struct queue_ll* queue)
 {
-    if (!queue->head) {
+    int value;
+    if (!queue_ll_try_dequeue(queue, &value)) {
         return INT_MAX;
     }
 
-    const int value = queue->head->data;
+    return value;
+}
+
+/**
+ * @brief Remove an item from the front of a queue, if there is one
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ *
+ * @return int 1 if an item was removed, or 0 if the queue is empty
+ */
+int queue_ll_try_dequeue(struct queue_ll* queue, int* value)
+{
+    if (queue_ll_empty(queue)) {
+        return 0;
+    }
+
+    *value = queue->head->data;
 
     struct node* to_delete = queue->head;
     queue->head = queue->head->next;
+    if (!queue->head) {
+        queue->tail = NULL;
+    }
     free(to_delete);
+    --queue->size;
+    check_watermarks(queue);
 
-    return value;
+    return 1;
+}
+
+/**
+ * @brief Add several items to the end of a queue
+ *
+ * The new nodes are chained together first and then linked onto the queue in one step.
+ *
+ * @param queue The queue to append to
+ * @param values The items to add, in order
+ * @param count The number of items to add
+ *
+ * @return unsigned int The number of items added, which is less than count only if allocation
+ *         failed
+ */
+unsigned int queue_ll_enqueue_batch(struct queue_ll* queue, const int* values, unsigned int count)
+{
+    if (!queue || count == 0) {
+        return 0;
+    }
+
+    struct node* first = NULL;
+    struct node* last = NULL;
+    unsigned int added = 0;
+
+    while (added < count) {
+        struct node* new_node = malloc(sizeof(*new_node));
+        if (!new_node) {
+            break;
+        }
+        new_node->data = values[added++];
+        new_node->next = NULL;
+
+        if (last) {
+            last->next = new_node;
+        }
+        else {
+            first = new_node;
+        }
+        last = new_node;
+    }
+    if (!first) {
+        return 0;
+    }
+
+    if (!queue->head) {
+        queue->head = first;
+    }
+    else {
+        queue->tail->next = first;
+    }
+    queue->tail = last;
+    queue->size += added;
+    check_watermarks(queue);
+
+    return added;
+}
+
+/**
+ * @brief Remove up to a given number of items from the front of a queue
+ *
+ * @param queue The queue to remove items from
+ * @param values Set to the removed items, in order
+ * @param max The most items to remove
+ *
+ * @return unsigned int The number of items removed
+ */
+unsigned int queue_ll_dequeue_batch(struct queue_ll* queue, int* values, unsigned int max)
+{
+    if (!queue) {
+        return 0;
+    }
+
+    unsigned int count = 0;
+    while (count < max && queue->head) {
+        struct node* to_delete = queue->head;
+        values[count++] = to_delete->data;
+        queue->head = to_delete->next;
+        free(to_delete);
+    }
+    if (!queue->head) {
+        queue->tail = NULL;
+    }
+    queue->size -= count;
+    check_watermarks(queue);
+
+    return count;
 }
 
 /**
@@ -112,3 +266,51 @@ int queue_ll_empty(struct queue_ll* queue)
 {
     return (!queue || !queue->head);
 }
+
+/**
+ * @brief Get the number of items in a queue
+ *
+ * @param queue The queue to check
+ *
+ * @return unsigned int The number of items in the queue
+ */
+unsigned int queue_ll_size(struct queue_ll* queue)
+{
+    if (!queue) {
+        return 0;
+    }
+    return queue->size;
+}
+
+/**
+ * @brief Set the sizes at which a queue reports that it is filling up and draining
+ *
+ * Once the queue holds high items, on_high is called. After that, once it holds low items or
+ * fewer, on_low is called, and the cycle starts again. Either callback may be NULL. The
+ * callbacks run inside the enqueue or dequeue that crossed the watermark and must not modify the
+ * queue.
+ *
+ * @param queue The queue to watch
+ * @param high The size that triggers on_high, or 0 to stop watching the queue
+ * @param low The size that triggers on_low, which should be less than high
+ * @param on_high The function to call when the queue fills up
+ * @param on_low The function to call when the queue drains
+ * @param context A value passed to both callbacks
+ */
+void queue_ll_set_watermarks(struct queue_ll* queue, unsigned int high, unsigned int low,
+                             void (*on_high)(struct queue_ll* queue, void* context),
+                             void (*on_low)(struct queue_ll* queue, void* context),
+                             void* context)
+{
+    if (!queue) {
+        return;
+    }
+
+    queue->high_watermark = high;
+    queue->low_watermark = low;
+    queue->on_high = on_high;
+    queue->on_low = on_low;
+    queue->watermark_context = context;
+    queue->above_high = 0;
+    check_watermarks(queue);
+}
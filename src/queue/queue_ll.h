@@ -20,6 +20,13 @@ struct node {
 struct queue_ll {
     struct node *head;
     struct node *tail;
+    unsigned int size;           /** The number of items in the queue. */
+    unsigned int high_watermark; /** The size at which on_high is called, or 0 if unset. */
+    unsigned int low_watermark;  /** The size at which on_low is called after on_high was. */
+    void (*on_high)(struct queue_ll *queue, void *context); /** Called when the queue fills up. */
+    void (*on_low)(struct queue_ll *queue, void *context);  /** Called when it drains again. */
+    void *watermark_context;     /** Passed to on_high and on_low. */
+    int above_high;              /** 1 between a call to on_high and the next call to on_low. */
 };
 
 /** Create a new queue */
@@ -34,7 +41,25 @@ void queue_ll_enqueue(struct queue_ll *queue, int data);
 /** Remove an item from the front of a queue and return it */
 int queue_ll_dequeue(struct queue_ll *queue);
 
+/** Remove an item from the front of a queue, if there is one */
+int queue_ll_try_dequeue(struct queue_ll *queue, int *value);
+
+/** Add several items to the end of a queue */
+unsigned int queue_ll_enqueue_batch(struct queue_ll *queue, const int *values, unsigned int count);
+
+/** Remove up to a given number of items from the front of a queue */
+unsigned int queue_ll_dequeue_batch(struct queue_ll *queue, int *values, unsigned int max);
+
 /** Check whether a queue is empty */
 int queue_ll_empty(struct queue_ll *queue);
 
+/** Get the number of items in a queue */
+unsigned int queue_ll_size(struct queue_ll *queue);
+
+/** Set the sizes at which a queue reports that it is filling up and draining */
+void queue_ll_set_watermarks(struct queue_ll *queue, unsigned int high, unsigned int low,
+                             void (*on_high)(struct queue_ll *queue, void *context),
+                             void (*on_low)(struct queue_ll *queue, void *context),
+                             void *context);
+
 #endif /* QUEUE_LL_H */
@@ -0,0 +1,409 @@
+/**
+ * @file scheduler.c
+ * @author agent <agent@local>
+ * @brief A thread pool that balances tasks between workers by work stealing
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * Every worker has its own work-stealing deque. A task submitted from inside a running task goes
+ * onto the deque of the worker running it, without taking any lock. A task submitted from
+ * outside the pool goes onto a shared injection list under the scheduler's mutex. A worker looks
+ * for work on its own deque first, then on the injection list, and then tries to steal from the
+ * other workers, starting at a random one so that thieves spread out. The shared lock is only
+ * taken for outside submissions and when a worker runs out of work, so the pool scales with the
+ * number of cores for workloads whose tasks spawn more tasks.
+ *
+ * A worker with nothing to do sleeps on a condition variable. Pushing onto a deque does not take
+ * the lock, so a pusher checks whether anyone is asleep after a full fence, and a worker checks
+ * every deque after announcing that it is about to sleep, also after a full fence. Either the
+ * sleeper sees the task or the pusher sees the sleeper.
+ */
+
+#include <stdlib.h>
+
+#include "scheduler.h"
+
+/** The initial capacity of each worker's deque. */
+#define SCHEDULER_DEQUE_CAPACITY 256
+
+struct scheduler_task {
+    void (*run)(void *arg);      /** The function to call. */
+    void *arg;                   /** The argument to call it with. */
+    struct scheduler_task *next; /** The next task on the injection list. */
+};
+
+/** The worker running on the current thread, or NULL outside the pool. */
+static _Thread_local struct scheduler_worker *current_worker = NULL;
+
+/**
+ * @brief Wake a sleeping worker if there is one
+ *
+ * @param scheduler The scheduler whose worker to wake
+ */
+static void wake_worker(struct scheduler *scheduler)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&scheduler->sleeping, memory_order_relaxed) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&scheduler->lock);
+    pthread_cond_signal(&scheduler->work_available);
+    pthread_mutex_unlock(&scheduler->lock);
+}
+
+/**
+ * @brief Take the oldest task from the injection list. The caller must hold the lock.
+ *
+ * @param scheduler The scheduler to take from
+ *
+ * @return struct scheduler_task* The task, or NULL if the list is empty
+ */
+static struct scheduler_task *take_injected(struct scheduler *scheduler)
+{
+    struct scheduler_task *task = scheduler->injected;
+
+    if (task) {
+        scheduler->injected = task->next;
+        if (!scheduler->injected) {
+            scheduler->last = NULL;
+        }
+    }
+
+    return task;
+}
+
+/**
+ * @brief Try to steal a task from any worker other than the given one
+ *
+ * @param worker The worker looking for work
+ *
+ * @return struct scheduler_task* The stolen task, or NULL if none was found
+ */
+static struct scheduler_task *steal_task(struct scheduler_worker *worker)
+{
+    struct scheduler *scheduler = worker->scheduler;
+    unsigned int count = scheduler->worker_count;
+
+    /* xorshift32 */
+    worker->rng ^= worker->rng << 13;
+    worker->rng ^= worker->rng >> 17;
+    worker->rng ^= worker->rng << 5;
+
+    unsigned int start = worker->rng % count;
+    for (unsigned int i = 0; i < count; ++i) {
+        struct scheduler_worker *victim = &scheduler->workers[(start + i) % count];
+        if (victim == worker) {
+            continue;
+        }
+
+        struct scheduler_task *task = ws_deque_steal(victim->deque);
+        if (task) {
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Check whether any worker's deque has tasks in it
+ *
+ * @param scheduler The scheduler to check
+ *
+ * @return int 1 if some deque is not empty, or 0 otherwise
+ */
+static int any_queued(struct scheduler *scheduler)
+{
+    for (unsigned int i = 0; i < scheduler->worker_count; ++i) {
+        if (ws_deque_size(scheduler->workers[i].deque) > 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Find the next task for a worker, sleeping until there is one
+ *
+ * @param worker The worker looking for work
+ *
+ * @return struct scheduler_task* The next task, or NULL if the scheduler is stopping
+ */
+static struct scheduler_task *find_task(struct scheduler_worker *worker)
+{
+    struct scheduler *scheduler = worker->scheduler;
+
+    for (;;) {
+        if (atomic_load_explicit(&scheduler->stopping, memory_order_acquire)) {
+            return NULL;
+        }
+
+        struct scheduler_task *task = ws_deque_pop(worker->deque);
+        if (task) {
+            return task;
+        }
+
+        pthread_mutex_lock(&scheduler->lock);
+        task = take_injected(scheduler);
+        pthread_mutex_unlock(&scheduler->lock);
+        if (task) {
+            return task;
+        }
+
+        task = steal_task(worker);
+        if (task) {
+            return task;
+        }
+
+        pthread_mutex_lock(&scheduler->lock);
+        atomic_fetch_add_explicit(&scheduler->sleeping, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (!scheduler->injected && !any_queued(scheduler) &&
+            !atomic_load_explicit(&scheduler->stopping, memory_order_relaxed)) {
+            pthread_cond_wait(&scheduler->work_available, &scheduler->lock);
+        }
+        atomic_fetch_sub_explicit(&scheduler->sleeping, 1, memory_order_relaxed);
+        pthread_mutex_unlock(&scheduler->lock);
+    }
+}
+
+/**
+ * @brief Run tasks until the scheduler stops. Used as each worker thread's start routine.
+ *
+ * @param arg The struct scheduler_worker the thread runs
+ *
+ * @return void* Always NULL
+ */
+static void *worker_main(void *arg)
+{
+    struct scheduler_worker *worker = arg;
+    struct scheduler *scheduler = worker->scheduler;
+    struct scheduler_task *task;
+
+    current_worker = worker;
+    while ((task = find_task(worker))) {
+        task->run(task->arg);
+        free(task);
+
+        if (atomic_fetch_sub_explicit(&scheduler->pending, 1, memory_order_acq_rel) == 1) {
+            pthread_mutex_lock(&scheduler->lock);
+            pthread_cond_broadcast(&scheduler->all_done);
+            pthread_mutex_unlock(&scheduler->lock);
+        }
+    }
+    current_worker = NULL;
+
+    return NULL;
+}
+
+/**
+ * @brief Stop a scheduler's workers and free its memory
+ *
+ * @param scheduler The scheduler to free
+ * @param started The number of workers whose threads were started
+ */
+static void scheduler_destroy(struct scheduler *scheduler, unsigned int started)
+{
+    atomic_store_explicit(&scheduler->stopping, 1, memory_order_release);
+    pthread_mutex_lock(&scheduler->lock);
+    pthread_cond_broadcast(&scheduler->work_available);
+    pthread_mutex_unlock(&scheduler->lock);
+
+    for (unsigned int i = 0; i < started; ++i) {
+        pthread_join(scheduler->workers[i].thread, NULL);
+    }
+
+    /* Discard any tasks that never ran */
+    struct scheduler_task *task;
+    while ((task = take_injected(scheduler))) {
+        free(task);
+    }
+    for (unsigned int i = 0; i < scheduler->worker_count; ++i) {
+        struct ws_deque *deque = scheduler->workers[i].deque;
+        if (!deque) {
+            continue;
+        }
+        while ((task = ws_deque_steal(deque))) {
+            free(task);
+        }
+        ws_deque_free(deque);
+    }
+
+    pthread_cond_destroy(&scheduler->all_done);
+    pthread_cond_destroy(&scheduler->work_available);
+    pthread_mutex_destroy(&scheduler->lock);
+    free(scheduler->workers);
+    free(scheduler);
+}
+
+/**
+ * @brief Initialize the lock and condition variables a scheduler's threads wait on
+ *
+ * Once this succeeds, scheduler_destroy can clean up after any later failure.
+ *
+ * @param scheduler The scheduler to initialize
+ *
+ * @return int 1 on success, or 0 if any of them could not be initialized, in which case none
+ *         are left to destroy
+ */
+static int scheduler_init_sync(struct scheduler *scheduler)
+{
+    if (pthread_mutex_init(&scheduler->lock, NULL) != 0) {
+        return 0;
+    }
+    if (pthread_cond_init(&scheduler->work_available, NULL) != 0) {
+        pthread_mutex_destroy(&scheduler->lock);
+        return 0;
+    }
+    if (pthread_cond_init(&scheduler->all_done, NULL) != 0) {
+        pthread_cond_destroy(&scheduler->work_available);
+        pthread_mutex_destroy(&scheduler->lock);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Create a scheduler and start its worker threads
+ *
+ * @param worker_count The number of worker threads to start, usually the number of cores
+ *
+ * @return struct scheduler* A pointer to the new scheduler, or NULL if it could not be created
+ */
+struct scheduler *scheduler_new(unsigned int worker_count)
+{
+    if (worker_count == 0) {
+        return NULL;
+    }
+
+    struct scheduler *scheduler = malloc(sizeof(*scheduler));
+    if (!scheduler) {
+        return NULL;
+    }
+
+    scheduler->workers = calloc(worker_count, sizeof(struct scheduler_worker));
+    if (!scheduler->workers) {
+        free(scheduler);
+        return NULL;
+    }
+    if (!scheduler_init_sync(scheduler)) {
+        free(scheduler->workers);
+        free(scheduler);
+        return NULL;
+    }
+    scheduler->worker_count = worker_count;
+    scheduler->injected = NULL;
+    scheduler->last = NULL;
+    atomic_init(&scheduler->sleeping, 0);
+    atomic_init(&scheduler->pending, 0);
+    atomic_init(&scheduler->stopping, 0);
+
+    for (unsigned int i = 0; i < worker_count; ++i) {
+        struct scheduler_worker *worker = &scheduler->workers[i];
+        worker->scheduler = scheduler;
+        worker->rng = 2654435761u * (i + 1);
+        worker->deque = ws_deque_new(SCHEDULER_DEQUE_CAPACITY);
+        if (!worker->deque) {
+            scheduler_destroy(scheduler, 0);
+            return NULL;
+        }
+    }
+
+    /* Start the threads only once every deque exists, since any worker may steal from any other */
+    for (unsigned int i = 0; i < worker_count; ++i) {
+        if (pthread_create(&scheduler->workers[i].thread, NULL, worker_main,
+                           &scheduler->workers[i]) != 0) {
+            scheduler_destroy(scheduler, i);
+            return NULL;
+        }
+    }
+
+    return scheduler;
+}
+
+/**
+ * @brief Stop a scheduler's workers and free its memory
+ *
+ * Tasks that are running are allowed to finish, but tasks that have not started are discarded.
+ * Call scheduler_wait first to run every task. This must not be called from one of the
+ * scheduler's own tasks.
+ *
+ * @param scheduler The scheduler to free
+ */
+void scheduler_free(struct scheduler *scheduler)
+{
+    if (!scheduler) {
+        return;
+    }
+
+    scheduler_destroy(scheduler, scheduler->worker_count);
+}
+
+/**
+ * @brief Submit a task to a scheduler
+ *
+ * A task submitted from one of the scheduler's own tasks is pushed onto the current worker's
+ * deque without locking, and is most likely run next by the same worker unless another steals
+ * it. Other submissions go onto the shared injection list.
+ *
+ * @param scheduler The scheduler to run the task
+ * @param run The function to call
+ * @param arg The argument to call it with
+ *
+ * @return int 1 if the task was submitted, or 0 if allocation failed
+ */
+int scheduler_submit(struct scheduler *scheduler, void (*run)(void *arg), void *arg)
+{
+    struct scheduler_task *task = malloc(sizeof(*task));
+    if (!task) {
+        return 0;
+    }
+    task->run = run;
+    task->arg = arg;
+    task->next = NULL;
+
+    atomic_fetch_add_explicit(&scheduler->pending, 1, memory_order_relaxed);
+
+    struct scheduler_worker *worker = current_worker;
+    if (worker && worker->scheduler == scheduler && ws_deque_push(worker->deque, task)) {
+        wake_worker(scheduler);
+        return 1;
+    }
+
+    pthread_mutex_lock(&scheduler->lock);
+    if (scheduler->last) {
+        scheduler->last->next = task;
+    }
+    else {
+        scheduler->injected = task;
+    }
+    scheduler->last = task;
+    if (atomic_load_explicit(&scheduler->sleeping, memory_order_relaxed)) {
+        pthread_cond_signal(&scheduler->work_available);
+    }
+    pthread_mutex_unlock(&scheduler->lock);
+
+    return 1;
+}
+
+/**
+ * @brief Wait until every submitted task has finished
+ *
+ * Tasks submitted by other tasks count too, so this returns once the whole tree of work is
+ * done. It must not be called from one of the scheduler's own tasks.
+ *
+ * @param scheduler The scheduler to wait for
+ */
+void scheduler_wait(struct scheduler *scheduler)
+{
+    pthread_mutex_lock(&scheduler->lock);
+    while (atomic_load_explicit(&scheduler->pending, memory_order_acquire) != 0) {
+        pthread_cond_wait(&scheduler->all_done, &scheduler->lock);
+    }
+    pthread_mutex_unlock(&scheduler->lock);
+}
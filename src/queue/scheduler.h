@@ -0,0 +1,55 @@
+/**
+ * @file scheduler.h
+ * @author agent <agent@local>
+ * @brief A thread pool that balances tasks between workers by work stealing
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "ws_deque.h"
+
+struct scheduler;
+struct scheduler_task;
+
+struct scheduler_worker {
+    struct scheduler *scheduler; /** The scheduler the worker belongs to. */
+    struct ws_deque *deque;      /** Tasks submitted by this worker's own tasks. */
+    pthread_t thread;            /** The thread running the worker. */
+    unsigned int rng;            /** State for picking which worker to steal from. */
+};
+
+struct scheduler {
+    struct scheduler_worker *workers; /** One worker per thread. */
+    unsigned int worker_count;        /** The number of workers. */
+    struct scheduler_task *injected;  /** Tasks submitted from outside the pool, oldest first. */
+    struct scheduler_task *last;      /** The newest task in injected. */
+    pthread_mutex_t lock;             /** Protects injected and last, and sleeping. */
+    pthread_cond_t work_available;    /** Signalled when a task is submitted to a sleeping pool. */
+    pthread_cond_t all_done;          /** Broadcast when pending falls to zero. */
+    atomic_uint sleeping;             /** The number of workers waiting for tasks. */
+    atomic_uint pending;              /** Tasks submitted but not yet finished. */
+    atomic_int stopping;              /** Set when the scheduler is being destroyed. */
+};
+
+/** Create a scheduler and start its worker threads */
+struct scheduler *scheduler_new(unsigned int worker_count);
+
+/** Stop a scheduler's workers and free its memory */
+void scheduler_free(struct scheduler *scheduler);
+
+/** Submit a task to a scheduler */
+int scheduler_submit(struct scheduler *scheduler, void (*run)(void *arg), void *arg);
+
+/** Wait until every submitted task has finished */
+void scheduler_wait(struct scheduler *scheduler);
+
+#endif /* SCHEDULER_H */
@@ -0,0 +1,388 @@
+/**
+ * @file segment_queue.c
+ * @author agent <agent@local>
+ * @brief An unbounded queue built from a linked list of fixed-size arrays
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * Like queue_ll, the queue grows without bound, but instead of one node per item it links
+ * segments that each hold a few hundred items. Enqueueing and dequeueing are usually just an
+ * array write or read, and the allocator is only involved once per segment. The last segment to
+ * be emptied is kept as a spare, so a queue whose size hovers around a segment boundary does not
+ * allocate and free a segment every time it crosses it.
+ *
+ * It offers the same operations as queue_ll, so switching a caller over only means changing the
+ * prefix. queue_ll is kept as the plain linked-list version, with its node-per-item layout.
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "segment_queue.h"
+
+_Static_assert(sizeof(struct queue_segment) == 1024, "a segment should be exactly 1 KiB");
+
+/**
+ * @brief Get an empty segment, reusing the queue's spare if it has one
+ *
+ * @param queue The queue the segment is for
+ *
+ * @return struct queue_segment* An empty segment, or NULL if allocation fails
+ */
+static struct queue_segment* segment_get(struct segment_queue* queue)
+{
+    struct queue_segment* segment = queue->spare;
+
+    if (segment) {
+        queue->spare = NULL;
+    }
+    else {
+        segment = malloc(sizeof(*segment));
+        if (!segment) {
+            return NULL;
+        }
+    }
+    segment->next = NULL;
+    segment->head = 0;
+    segment->tail = 0;
+
+    return segment;
+}
+
+/**
+ * @brief Get the tail segment if it has room, or link a new one onto the queue
+ *
+ * @param queue The queue to make room in
+ *
+ * @return struct queue_segment* A segment with room for at least one item, or NULL if allocation
+ *         fails
+ */
+static struct queue_segment* segment_with_room(struct segment_queue* queue)
+{
+    if (queue->tail && queue->tail->tail < SEGMENT_QUEUE_SEGMENT_CAPACITY) {
+        return queue->tail;
+    }
+
+    struct queue_segment* segment = segment_get(queue);
+    if (!segment) {
+        return NULL;
+    }
+
+    if (!queue->tail) {
+        queue->head = segment;
+    }
+    else {
+        queue->tail->next = segment;
+    }
+    queue->tail = segment;
+
+    return segment;
+}
+
+/**
+ * @brief Retire the head segment once it has been read to the end, or rewind it if it is the
+ * only one
+ *
+ * The retired segment becomes the queue's spare.
+ *
+ * @param queue The queue whose head segment was just read from
+ */
+static void segment_retire_head(struct segment_queue* queue)
+{
+    struct queue_segment* head = queue->head;
+
+    if (head->head != head->tail) {
+        return;
+    }
+
+    if (head->next) {
+        queue->head = head->next;
+        free(queue->spare);
+        queue->spare = head;
+    }
+    else {
+        head->head = 0;
+        head->tail = 0;
+    }
+}
+
+/**
+ * @brief Call the queue's watermark callbacks if its size has crossed a watermark
+ *
+ * This follows queue_ll: on_high is called once when the size reaches the high watermark, and
+ * not again until on_low has been called because the size fell to the low watermark.
+ *
+ * @param queue The queue whose size just changed
+ */
+static void check_watermarks(struct segment_queue* queue)
+{
+    if (queue->high_watermark == 0) {
+        return;
+    }
+
+    if (!queue->above_high && queue->size >= queue->high_watermark) {
+        queue->above_high = 1;
+        if (queue->on_high) {
+            queue->on_high(queue, queue->watermark_context);
+        }
+    }
+    else if (queue->above_high && queue->size <= queue->low_watermark) {
+        queue->above_high = 0;
+        if (queue->on_low) {
+            queue->on_low(queue, queue->watermark_context);
+        }
+    }
+}
+
+/**
+ * @brief Create a new queue
+ *
+ * No segment is allocated until the first item is enqueued.
+ *
+ * @return struct segment_queue* A pointer to the new queue structure
+ */
+struct segment_queue* segment_queue_init()
+{
+    struct segment_queue* queue = malloc(sizeof(*queue));
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->spare = NULL;
+    queue->size = 0;
+    queue->high_watermark = 0;
+    queue->low_watermark = 0;
+    queue->on_high = NULL;
+    queue->on_low = NULL;
+    queue->watermark_context = NULL;
+    queue->above_high = 0;
+
+    return queue;
+}
+
+/**
+ * @brief Free memory used by a queue
+ *
+ * @param queue The queue to free memory from
+ */
+void segment_queue_free(struct segment_queue* queue)
+{
+    if (!queue) {
+        return;
+    }
+
+    struct queue_segment* current = queue->head;
+    while (current) {
+        queue->head = current->next;
+        free(current);
+        current = queue->head;
+    }
+    free(queue->spare);
+    free(queue);
+}
+
+/**
+ * @brief Add an item to the end of a queue
+ *
+ * @param queue The queue to append to
+ * @param data The item to add to the queue
+ */
+void segment_queue_enqueue(struct segment_queue* queue, int data)
+{
+    if (!queue) {
+        return;
+    }
+
+    struct queue_segment* segment = segment_with_room(queue);
+    if (!segment) {
+        return;
+    }
+
+    segment->data[segment->tail++] = data;
+    ++queue->size;
+    check_watermarks(queue);
+}
+
+/**
+ * @brief Remove an item from the front of a queue and return it
+ *
+ * Since INT_MAX is also returned when the queue is empty, use segment_queue_try_dequeue if the
+ * queue may hold INT_MAX.
+ *
+ * @param queue The queue to remove an item from
+ *
+ * @return int The value of the first item in the queue, or INT_MAX if the queue is empty
+ */
+int segment_queue_dequeue(struct segment_queue* queue)
+{
+    int value;
+    if (!segment_queue_try_dequeue(queue, &value)) {
+        return INT_MAX;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Remove an item from the front of a queue, if there is one
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ *
+ * @return int 1 if an item was removed, or 0 if the queue is empty
+ */
+int segment_queue_try_dequeue(struct segment_queue* queue, int* value)
+{
+    if (segment_queue_empty(queue)) {
+        return 0;
+    }
+
+    struct queue_segment* head = queue->head;
+    *value = head->data[head->head++];
+    --queue->size;
+    segment_retire_head(queue);
+    check_watermarks(queue);
+
+    return 1;
+}
+
+/**
+ * @brief Add several items to the end of a queue
+ *
+ * The items are copied in with one memcpy per segment they land in.
+ *
+ * @param queue The queue to append to
+ * @param values The items to add, in order
+ * @param count The number of items to add
+ *
+ * @return unsigned int The number of items added, which is less than count only if allocation
+ *         failed
+ */
+unsigned int segment_queue_enqueue_batch(struct segment_queue* queue, const int* values,
+                                         unsigned int count)
+{
+    if (!queue) {
+        return 0;
+    }
+
+    unsigned int added = 0;
+    while (added < count) {
+        struct queue_segment* segment = segment_with_room(queue);
+        if (!segment) {
+            break;
+        }
+
+        unsigned int chunk = SEGMENT_QUEUE_SEGMENT_CAPACITY - segment->tail;
+        if (chunk > count - added) {
+            chunk = count - added;
+        }
+        memcpy(&segment->data[segment->tail], &values[added], sizeof(int) * chunk);
+        segment->tail += chunk;
+        added += chunk;
+    }
+    queue->size += added;
+    check_watermarks(queue);
+
+    return added;
+}
+
+/**
+ * @brief Remove up to a given number of items from the front of a queue
+ *
+ * The items are copied out with one memcpy per segment they come from.
+ *
+ * @param queue The queue to remove items from
+ * @param values Set to the removed items, in order
+ * @param max The most items to remove
+ *
+ * @return unsigned int The number of items removed
+ */
+unsigned int segment_queue_dequeue_batch(struct segment_queue* queue, int* values,
+                                         unsigned int max)
+{
+    if (!queue) {
+        return 0;
+    }
+
+    unsigned int count = 0;
+    while (count < max && queue->size > 0) {
+        struct queue_segment* head = queue->head;
+
+        unsigned int chunk = head->tail - head->head;
+        if (chunk > max - count) {
+            chunk = max - count;
+        }
+        memcpy(&values[count], &head->data[head->head], sizeof(int) * chunk);
+        head->head += chunk;
+        count += chunk;
+        queue->size -= chunk;
+        segment_retire_head(queue);
+    }
+    check_watermarks(queue);
+
+    return count;
+}
+
+/**
+ * @brief Get the number of items in a queue
+ *
+ * @param queue The queue to check
+ *
+ * @return unsigned int The number of items in the queue
+ */
+unsigned int segment_queue_size(struct segment_queue* queue)
+{
+    if (!queue) {
+        return 0;
+    }
+    return queue->size;
+}
+
+/**
+ * @brief Check whether a queue is empty
+ *
+ * @param queue The queue to check
+ *
+ * @return int 1 if the queue is empty, or 0 otherwise
+ */
+int segment_queue_empty(struct segment_queue* queue)
+{
+    return (!queue || queue->size == 0);
+}
+
+/**
+ * @brief Set the sizes at which a queue reports that it is filling up and draining
+ *
+ * The callbacks behave as they do for queue_ll_set_watermarks. They run inside the operation
+ * that crossed the watermark and must not modify the queue.
+ *
+ * @param queue The queue to watch
+ * @param high The size that triggers on_high, or 0 to stop watching the queue
+ * @param low The size that triggers on_low, which should be less than high
+ * @param on_high The function to call when the queue fills up
+ * @param on_low The function to call when the queue drains
+ * @param context A value passed to both callbacks
+ */
+void segment_queue_set_watermarks(struct segment_queue* queue, unsigned int high,
+                                  unsigned int low,
+                                  void (*on_high)(struct segment_queue* queue, void* context),
+                                  void (*on_low)(struct segment_queue* queue, void* context),
+                                  void* context)
+{
+    if (!queue) {
+        return;
+    }
+
+    queue->high_watermark = high;
+    queue->low_watermark = low;
+    queue->on_high = on_high;
+    queue->on_low = on_low;
+    queue->watermark_context = context;
+    queue->above_high = 0;
+    check_watermarks(queue);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file segment_queue.h
+ * @author agent <agent@local>
+ * @brief An unbounded queue built from a linked list of fixed-size arrays
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef SEGMENT_QUEUE_H
+#define SEGMENT_QUEUE_H
+
+/** The number of items a segment holds, chosen so that a segment is exactly 1 KiB. */
+#define SEGMENT_QUEUE_SEGMENT_CAPACITY 252
+
+struct queue_segment {
+    struct queue_segment *next; /** The segment holding newer items, or NULL. */
+    unsigned int head;          /** The index of the first unread item. */
+    unsigned int tail;          /** The index one past the last item. */
+    int data[SEGMENT_QUEUE_SEGMENT_CAPACITY];
+};
+
+struct segment_queue {
+    struct queue_segment *head;  /** The segment items are dequeued from. */
+    struct queue_segment *tail;  /** The segment items are enqueued to. */
+    struct queue_segment *spare; /** An emptied segment kept for reuse, or NULL. */
+    unsigned int size;           /** The number of items in the queue. */
+    unsigned int high_watermark; /** The size at which on_high is called, or 0 if unset. */
+    unsigned int low_watermark;  /** The size at which on_low is called after on_high was. */
+    void (*on_high)(struct segment_queue *queue, void *context); /** Called when it fills up. */
+    void (*on_low)(struct segment_queue *queue, void *context);  /** Called when it drains. */
+    void *watermark_context;     /** Passed to on_high and on_low. */
+    int above_high;              /** 1 between a call to on_high and the next call to on_low. */
+};
+
+/** Create a new queue */
+struct segment_queue *segment_queue_init();
+
+/** Free memory used by a queue */
+void segment_queue_free(struct segment_queue *queue);
+
+/** Add an item to the end of a queue */
+void segment_queue_enqueue(struct segment_queue *queue, int data);
+
+/** Remove an item from the front of a queue and return it */
+int segment_queue_dequeue(struct segment_queue *queue);
+
+/** Remove an item from the front of a queue, if there is one */
+int segment_queue_try_dequeue(struct segment_queue *queue, int *value);
+
+/** Add several items to the end of a queue */
+unsigned int segment_queue_enqueue_batch(struct segment_queue *queue, const int *values,
+                                         unsigned int count);
+
+/** Remove up to a given number of items from the front of a queue */
+unsigned int segment_queue_dequeue_batch(struct segment_queue *queue, int *values,
+                                         unsigned int max);
+
+/** Get the number of items in a queue */
+unsigned int segment_queue_size(struct segment_queue *queue);
+
+/** Check whether a queue is empty */
+int segment_queue_empty(struct segment_queue *queue);
+
+/** Set the sizes at which a queue reports that it is filling up and draining */
+void segment_queue_set_watermarks(struct segment_queue *queue, unsigned int high,
+                                  unsigned int low,
+                                  void (*on_high)(struct segment_queue *queue, void *context),
+                                  void (*on_low)(struct segment_queue *queue, void *context),
+                                  void *context);
+
+#endif /* SEGMENT_QUEUE_H */
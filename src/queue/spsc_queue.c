@@ -0,0 +1,264 @@
+/**
+ * @file spsc_queue.c
+ * @author agent <agent@local>
+ * @brief A lock-free queue for passing items from one thread to another
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * Exactly one thread may enqueue and exactly one thread may dequeue. Each index is written by
+ * only one side, so no compare-and-swap is needed: the producer fills a slot and then publishes
+ * it by advancing tail with a release store, and the consumer reads tail with an acquire load
+ * before reading the slot. Freeing a slot works the same way in the other direction.
+ *
+ * head and tail sit on separate cache lines so the two threads do not invalidate each other's
+ * line on every operation. Each side also keeps a private copy of the other side's index and
+ * only rereads the shared one when the copy says the queue is full (or empty). While the queue
+ * is neither, an operation touches no cache line the other thread writes.
+ *
+ * The indices count items rather than positions and are masked on use, so they may wrap around
+ * freely and tail - head is always the number of items in the queue.
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "spsc_queue.h"
+
+/** The smallest capacity a queue is created with. */
+#define SPSC_QUEUE_MIN_CAPACITY 4
+
+/**
+ * @brief Create a new single-producer, single-consumer queue
+ *
+ * @param capacity The most items the queue can hold, rounded up to a power of two
+ *
+ * @return struct spsc_queue* A pointer to the new queue, or NULL if allocation fails
+ */
+struct spsc_queue *spsc_queue_new(int capacity)
+{
+    unsigned int rounded = SPSC_QUEUE_MIN_CAPACITY;
+    while (rounded < (unsigned int)capacity && rounded <= UINT_MAX / 4) {
+        rounded *= 2;
+    }
+
+    struct spsc_queue *queue = aligned_alloc(_Alignof(struct spsc_queue), sizeof(*queue));
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->data = malloc(sizeof(int) * rounded);
+    if (!queue->data) {
+        free(queue);
+        return NULL;
+    }
+    queue->capacity = rounded;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    queue->cached_head = 0;
+    queue->cached_tail = 0;
+
+    return queue;
+}
+
+/**
+ * @brief Free memory used by a single-producer, single-consumer queue
+ *
+ * Neither the producer nor the consumer may be using the queue.
+ *
+ * @param queue The queue to free
+ */
+void spsc_queue_free(struct spsc_queue *queue)
+{
+    if (!queue) {
+        return;
+    }
+
+    free(queue->data);
+    free(queue);
+}
+
+/**
+ * @brief Add an item to the end of a queue, if there is room
+ *
+ * Only the producer thread may call this.
+ *
+ * @param queue The queue to add to
+ * @param value The value of the item to add
+ *
+ * @return int 1 if the item was added, or 0 if the queue is full
+ */
+int spsc_queue_try_enqueue(struct spsc_queue *queue, int value)
+{
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    if (tail - queue->cached_head == queue->capacity) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - queue->cached_head == queue->capacity) {
+            return 0;
+        }
+    }
+
+    queue->data[tail & (queue->capacity - 1)] = value;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * @brief Remove the item at the front of a queue, if there is one
+ *
+ * Only the consumer thread may call this.
+ *
+ * @param queue The queue to remove an item from
+ * @param value Set to the value of the removed item
+ *
+ * @return int 1 if an item was removed, or 0 if the queue is empty
+ */
+int spsc_queue_try_dequeue(struct spsc_queue *queue, int *value)
+{
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (head == queue->cached_tail) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->cached_tail) {
+            return 0;
+        }
+    }
+
+    *value = queue->data[head & (queue->capacity - 1)];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * @brief Copy items into a ring buffer, splitting the copy where it wraps
+ *
+ * @param queue The queue that owns the ring
+ * @param index The position in the ring to start at, before masking
+ * @param values The items to copy
+ * @param count The number of items to copy
+ */
+static void copy_into_ring(struct spsc_queue *queue, unsigned int index, const int *values,
+                           unsigned int count)
+{
+    unsigned int start = index & (queue->capacity - 1);
+    unsigned int first = queue->capacity - start;
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(&queue->data[start], values, sizeof(int) * first);
+    memcpy(queue->data, &values[first], sizeof(int) * (count - first));
+}
+
+/**
+ * @brief Copy items out of a ring buffer, splitting the copy where it wraps
+ *
+ * @param queue The queue that owns the ring
+ * @param index The position in the ring to start at, before masking
+ * @param values Where to store the items
+ * @param count The number of items to copy
+ */
+static void copy_from_ring(struct spsc_queue *queue, unsigned int index, int *values,
+                           unsigned int count)
+{
+    unsigned int start = index & (queue->capacity - 1);
+    unsigned int first = queue->capacity - start;
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(values, &queue->data[start], sizeof(int) * first);
+    memcpy(&values[first], queue->data, sizeof(int) * (count - first));
+}
+
+/**
+ * @brief Add as many of several items to the end of a queue as there is room for
+ *
+ * All of the items are published to the consumer with a single store, so the cost of
+ * synchronizing is paid once per batch instead of once per item. Only the producer thread may
+ * call this.
+ *
+ * @param queue The queue to add to
+ * @param values The items to add, in order
+ * @param count The number of items to add
+ *
+ * @return unsigned int The number of items added from the start of values
+ */
+unsigned int spsc_queue_try_enqueue_batch(struct spsc_queue *queue, const int *values,
+                                          unsigned int count)
+{
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    if (queue->capacity - (tail - queue->cached_head) < count) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    }
+    unsigned int room = queue->capacity - (tail - queue->cached_head);
+    if (count > room) {
+        count = room;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    copy_into_ring(queue, tail, values, count);
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+
+    return count;
+}
+
+/**
+ * @brief Remove up to a given number of items from the front of a queue
+ *
+ * The slots are handed back to the producer with a single store. Only the consumer thread may
+ * call this.
+ *
+ * @param queue The queue to remove items from
+ * @param values Set to the removed items, in order
+ * @param max The most items to remove
+ *
+ * @return unsigned int The number of items removed
+ */
+unsigned int spsc_queue_try_dequeue_batch(struct spsc_queue *queue, int *values,
+                                          unsigned int max)
+{
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (queue->cached_tail - head < max) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    }
+    unsigned int count = queue->cached_tail - head;
+    if (count > max) {
+        count = max;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    copy_from_ring(queue, head, values, count);
+    atomic_store_explicit(&queue->head, head + count, memory_order_release);
+
+    return count;
+}
+
+/**
+ * @brief Get the number of items in a queue
+ *
+ * When called while the other thread is active, the answer may be out of date by the time it is
+ * returned.
+ *
+ * @param queue The queue to check
+ *
+ * @return unsigned int The number of items in the queue
+ */
+unsigned int spsc_queue_size(struct spsc_queue *queue)
+{
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    return tail - head;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file spsc_queue.h
+ * @author agent <agent@local>
+ * @brief A lock-free queue for passing items from one thread to another
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdatomic.h>
+
+struct spsc_queue {
+    /* Written only by the consumer */
+    _Alignas(64) atomic_uint head; /** The number of items dequeued so far. */
+    unsigned int cached_tail;      /** The consumer's last look at tail. */
+
+    /* Written only by the producer */
+    _Alignas(64) atomic_uint tail; /** The number of items enqueued so far. */
+    unsigned int cached_head;      /** The producer's last look at head. */
+
+    /* Never written after the queue is created */
+    _Alignas(64) int *data;        /** A ring buffer holding the queue's items. */
+    unsigned int capacity;         /** The length of data, always a power of two. */
+};
+
+/** Create a new single-producer, single-consumer queue */
+struct spsc_queue *spsc_queue_new(int capacity);
+
+/** Free memory used by a single-producer, single-consumer queue */
+void spsc_queue_free(struct spsc_queue *queue);
+
+/** Add an item to the end of a queue, if there is room. Only the producer may call this. */
+int spsc_queue_try_enqueue(struct spsc_queue *queue, int value);
+
+/** Remove the item at the front of a queue, if there is one. Only the consumer may call this. */
+int spsc_queue_try_dequeue(struct spsc_queue *queue, int *value);
+
+/** Add as many of several items to the end of a queue as there is room for */
+unsigned int spsc_queue_try_enqueue_batch(struct spsc_queue *queue, const int *values,
+                                          unsigned int count);
+
+/** Remove up to a given number of items from the front of a queue */
+unsigned int spsc_queue_try_dequeue_batch(struct spsc_queue *queue, int *values,
+                                          unsigned int max);
+
+/** Get the number of items in a queue */
+unsigned int spsc_queue_size(struct spsc_queue *queue);
+
+#endif /* SPSC_QUEUE_H */
@@ -0,0 +1,280 @@
+/**
+ * @file ws_deque.c
+ * @author agent <agent@local>
+ * @brief A work-stealing deque, owned by one thread and stolen from by others
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ * This is the Chase-Lev deque, with the memory orderings worked out for C11 by Le, Pop, Cohen
+ * and Zappa Nardelli. The owning thread pushes and pops at the bottom like a stack, which keeps
+ * the work it touched most recently (and whose data is still in its cache) for itself. Other
+ * threads steal from the top, taking the oldest items, which tend to be the largest pieces of
+ * work. The owner only contends with thieves when one item is left.
+ *
+ * The buffer grows when it fills. Because a thief may still be reading the old buffer, it is
+ * kept on a list and only freed with the deque.
+ */
+
+#include <stdlib.h>
+
+#include "ws_deque.h"
+
+/** The smallest capacity a deque is created with. */
+#define WS_DEQUE_MIN_CAPACITY 16
+
+struct ws_array {
+    struct ws_array *retired; /** The buffer retired before this one, once this one is retired. */
+    long capacity;            /** The number of items the buffer holds, always a power of two. */
+    _Atomic(void *) items[];
+};
+
+/**
+ * @brief Allocate a buffer for a deque
+ *
+ * @param capacity The number of items the buffer holds, which must be a power of two
+ *
+ * @return struct ws_array* The new buffer, or NULL if allocation fails
+ */
+static struct ws_array *ws_array_new(long capacity)
+{
+    struct ws_array *array = malloc(sizeof(*array) + sizeof(array->items[0]) * capacity);
+    if (!array) {
+        return NULL;
+    }
+    array->retired = NULL;
+    array->capacity = capacity;
+
+    return array;
+}
+
+/**
+ * @brief Get the item at an index in a buffer
+ *
+ * @param array The buffer to read
+ * @param index The index of the item, before wrapping
+ *
+ * @return void* The item
+ */
+static inline void *ws_array_get(struct ws_array *array, long index)
+{
+    return atomic_load_explicit(&array->items[index & (array->capacity - 1)],
+                                memory_order_relaxed);
+}
+
+/**
+ * @brief Set the item at an index in a buffer
+ *
+ * @param array The buffer to write
+ * @param index The index of the item, before wrapping
+ * @param item The item to store
+ */
+static inline void ws_array_put(struct ws_array *array, long index, void *item)
+{
+    atomic_store_explicit(&array->items[index & (array->capacity - 1)], item,
+                          memory_order_relaxed);
+}
+
+/**
+ * @brief Create a new work-stealing deque
+ *
+ * @param capacity The number of items the deque should hold before it needs to grow
+ *
+ * @return struct ws_deque* A pointer to the new deque, or NULL if allocation fails
+ */
+struct ws_deque *ws_deque_new(long capacity)
+{
+    long rounded = WS_DEQUE_MIN_CAPACITY;
+    while (rounded < capacity) {
+        rounded *= 2;
+    }
+
+    struct ws_deque *deque = aligned_alloc(_Alignof(struct ws_deque), sizeof(*deque));
+    if (!deque) {
+        return NULL;
+    }
+
+    struct ws_array *array = ws_array_new(rounded);
+    if (!array) {
+        free(deque);
+        return NULL;
+    }
+
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->array, array);
+    deque->retired = NULL;
+
+    return deque;
+}
+
+/**
+ * @brief Free memory used by a work-stealing deque
+ *
+ * No other thread may be using the deque. Items still in it are not freed.
+ *
+ * @param deque The deque to free
+ */
+void ws_deque_free(struct ws_deque *deque)
+{
+    if (!deque) {
+        return;
+    }
+
+    struct ws_array *array = deque->retired;
+    while (array) {
+        struct ws_array *next = array->retired;
+        free(array);
+        array = next;
+    }
+    free(atomic_load_explicit(&deque->array, memory_order_relaxed));
+    free(deque);
+}
+
+/**
+ * @brief Replace a full buffer with one twice the size
+ *
+ * @param deque The deque to grow
+ * @param array The deque's current buffer
+ * @param top The index of the first item
+ * @param bottom The index one past the last item
+ *
+ * @return struct ws_array* The new buffer, or NULL if allocation fails
+ */
+static struct ws_array *ws_deque_grow(struct ws_deque *deque, struct ws_array *array, long top,
+                                      long bottom)
+{
+    struct ws_array *bigger = ws_array_new(array->capacity * 2);
+    if (!bigger) {
+        return NULL;
+    }
+
+    for (long i = top; i < bottom; ++i) {
+        ws_array_put(bigger, i, ws_array_get(array, i));
+    }
+    atomic_store_explicit(&deque->array, bigger, memory_order_release);
+
+    array->retired = deque->retired;
+    deque->retired = array;
+
+    return bigger;
+}
+
+/**
+ * @brief Push an item onto the bottom of a deque
+ *
+ * Only the thread that owns the deque may call this.
+ *
+ * @param deque The deque to push onto
+ * @param item The item to push, which must not be NULL
+ *
+ * @return int 1 if the item was pushed, or 0 if the deque was full and could not grow
+ */
+int ws_deque_push(struct ws_deque *deque, void *item)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    struct ws_array *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    if (bottom - top > array->capacity - 1) {
+        array = ws_deque_grow(deque, array, top, bottom);
+        if (!array) {
+            return 0;
+        }
+    }
+
+    /* The paper uses a release fence and a relaxed store; a release store orders the same writes
+     * and is visible to thread sanitizers, which do not model fences */
+    ws_array_put(array, bottom, item);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * @brief Pop the item at the bottom of a deque
+ *
+ * Only the thread that owns the deque may call this.
+ *
+ * @param deque The deque to pop from
+ *
+ * @return void* The most recently pushed item, or NULL if the deque is empty
+ */
+void *ws_deque_pop(struct ws_deque *deque)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    struct ws_array *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    /* Claim the bottom item before looking at top, so a thief cannot take it unnoticed */
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    void *item = ws_array_get(array, bottom);
+    if (top == bottom) {
+        /* This is the last item, so race the thieves for it */
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                     memory_order_seq_cst,
+                                                     memory_order_relaxed)) {
+            item = NULL;
+        }
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return item;
+}
+
+/**
+ * @brief Steal the item at the top of a deque
+ *
+ * Any thread may call this. A steal can fail because another thread took the item first, in
+ * which case the deque may not be empty.
+ *
+ * @param deque The deque to steal from
+ *
+ * @return void* The least recently pushed item, or NULL if the deque is empty or the steal lost
+ *         a race
+ */
+void *ws_deque_steal(struct ws_deque *deque)
+{
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom) {
+        return NULL;
+    }
+
+    struct ws_array *array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    void *item = ws_array_get(array, top);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return NULL;
+    }
+
+    return item;
+}
+
+/**
+ * @brief Get the number of items in a deque
+ *
+ * Other threads may change the deque at any time, so the answer can be out of date as soon as
+ * it is returned.
+ *
+ * @param deque The deque to check
+ *
+ * @return long The number of items in the deque
+ */
+long ws_deque_size(struct ws_deque *deque)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    return bottom > top ? bottom - top : 0;
+}
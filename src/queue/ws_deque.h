@@ -0,0 +1,44 @@
+/**
+ * @file ws_deque.h
+ * @author agent <agent@local>
+ * @brief A work-stealing deque, owned by one thread and stolen from by others
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 agent
+ *
+ */
+
+#ifndef WS_DEQUE_H
+#define WS_DEQUE_H
+
+#include <stdatomic.h>
+
+struct ws_array;
+
+struct ws_deque {
+    _Alignas(64) atomic_long top;     /** The index thieves steal from. */
+    _Alignas(64) atomic_long bottom;  /** The index the owner pushes to and pops from. */
+    _Atomic(struct ws_array *) array; /** The ring buffer holding the items. */
+    struct ws_array *retired;         /** Outgrown buffers that thieves may still be reading. */
+};
+
+/** Create a new work-stealing deque */
+struct ws_deque *ws_deque_new(long capacity);
+
+/** Free memory used by a work-stealing deque */
+void ws_deque_free(struct ws_deque *deque);
+
+/** Push an item onto the bottom of a deque. Only the owner may call this. */
+int ws_deque_push(struct ws_deque *deque, void *item);
+
+/** Pop the item at the bottom of a deque. Only the owner may call this. */
+void *ws_deque_pop(struct ws_deque *deque);
+
+/** Steal the item at the top of a deque. Any thread may call this. */
+void *ws_deque_steal(struct ws_deque *deque);
+
+/** Get the number of items in a deque */
+long ws_deque_size(struct ws_deque *deque);
+
+#endif /* WS_DEQUE_H */
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <math.h>
+#include <stdlib.h>
 
 #include "../src/binary_tree/binary_tree.h"
 #include "../unity/src/unity.h"
@@ -40,6 +41,11 @@ void test_binary_tree_get_node_count(void)
 
     TEST_ASSERT_EQUAL(4, binary_tree_get_node_count(root));
 
+    binary_tree_insert(root, 9);
+
+    TEST_ASSERT_EQUAL(4, binary_tree_get_node_count(root));
+    TEST_ASSERT_EQUAL(2, binary_tree_get_node_count(root->left));
+
     binary_tree_free(root);
 }
 
@@ -59,6 +65,34 @@ void test_binary_tree_is_in_tree(void)
     binary_tree_free(root);
 }
 
+void test_binary_tree_is_in_tree_sorted(void)
+{
+    struct node *root = node_init(500);
+    int probes[300];
+    unsigned char hits[(300 + 7) / 8];
+    unsigned int expected = 0;
+
+    for (int i = 0; i < 1000; ++i) {
+        binary_tree_insert(root, ((i * 7919) % 1000) * 3);
+    }
+    for (int i = 0; i < 300; ++i) {
+        probes[i] = i * 10 - 5 - (i % 3 == 0);
+    }
+
+    TEST_ASSERT_EQUAL(0, binary_tree_is_in_tree_sorted(NULL, probes, 300, hits));
+
+    for (int i = 0; i < 300; ++i) {
+        expected += binary_tree_is_in_tree(root, probes[i]);
+    }
+    TEST_ASSERT_EQUAL(expected, binary_tree_is_in_tree_sorted(root, probes, 300, hits));
+
+    for (int i = 0; i < 300; ++i) {
+        TEST_ASSERT_EQUAL(binary_tree_is_in_tree(root, probes[i]), (hits[i / 8] >> (i % 8)) & 1);
+    }
+
+    binary_tree_free(root);
+}
+
 void test_binary_tree_get_height(void)
 {
     struct node *root = node_init(15);
@@ -115,6 +149,44 @@ void test_binary_tree_get_max(void)
     binary_tree_free(root);
 }
 
+void test_binary_tree_rank(void)
+{
+    struct node *root = node_init(15);
+
+    binary_tree_insert(root, 10);
+    binary_tree_insert(root, 7);
+    binary_tree_insert(root, 12);
+    binary_tree_insert(root, 9);
+    binary_tree_insert(root, 22);
+    binary_tree_insert(root, 20);
+
+    TEST_ASSERT_EQUAL(0, binary_tree_rank(root, 7));
+    TEST_ASSERT_EQUAL(3, binary_tree_rank(root, 12));
+    TEST_ASSERT_EQUAL(4, binary_tree_rank(root, 13));
+    TEST_ASSERT_EQUAL(7, binary_tree_rank(root, 100));
+
+    binary_tree_free(root);
+}
+
+void test_binary_tree_select(void)
+{
+    struct node *root = node_init(15);
+
+    binary_tree_insert(root, 10);
+    binary_tree_insert(root, 7);
+    binary_tree_insert(root, 12);
+    binary_tree_insert(root, 9);
+    binary_tree_insert(root, 22);
+    binary_tree_insert(root, 20);
+
+    TEST_ASSERT_EQUAL(7, binary_tree_select(root, 0));
+    TEST_ASSERT_EQUAL(12, binary_tree_select(root, 3));
+    TEST_ASSERT_EQUAL(22, binary_tree_select(root, 6));
+    TEST_ASSERT_EQUAL(INT_MAX, binary_tree_select(root, 7));
+
+    binary_tree_free(root);
+}
+
 void test_binary_tree_is_bst(void)
 {
     struct node *root = node_init(15);
@@ -148,16 +220,236 @@ void test_binary_tree_print(void)
     binary_tree_free(root);
 }
 
+void test_binary_tree_iter(void)
+{
+    struct node *root = node_init(5);
+    struct binary_tree_iter iter;
+    struct node *current;
+    int preorder[] = {5, 3, -3, 4, 9, 14};
+    int inorder[] = {-3, 3, 4, 5, 9, 14};
+    int postorder[] = {-3, 4, 3, 14, 9, 5};
+    int i;
+
+    binary_tree_insert(root, 3);
+    binary_tree_insert(root, 9);
+    binary_tree_insert(root, 4);
+    binary_tree_insert(root, 14);
+    binary_tree_insert(root, -3);
+
+    i = 0;
+    binary_tree_iter_init(&iter, root, BINARY_TREE_PREORDER);
+    while ((current = binary_tree_iter_next(&iter))) {
+        TEST_ASSERT_EQUAL(preorder[i++], current->data);
+    }
+    TEST_ASSERT_EQUAL(0, binary_tree_iter_failed(&iter));
+    binary_tree_iter_free(&iter);
+    TEST_ASSERT_EQUAL(6, i);
+
+    i = 0;
+    binary_tree_iter_init(&iter, root, BINARY_TREE_INORDER);
+    while ((current = binary_tree_iter_next(&iter))) {
+        TEST_ASSERT_EQUAL(inorder[i++], current->data);
+    }
+    TEST_ASSERT_EQUAL(0, binary_tree_iter_failed(&iter));
+    binary_tree_iter_free(&iter);
+    TEST_ASSERT_EQUAL(6, i);
+
+    i = 0;
+    binary_tree_iter_init(&iter, root, BINARY_TREE_POSTORDER);
+    while ((current = binary_tree_iter_next(&iter))) {
+        TEST_ASSERT_EQUAL(postorder[i++], current->data);
+    }
+    TEST_ASSERT_EQUAL(0, binary_tree_iter_failed(&iter));
+    binary_tree_iter_free(&iter);
+    TEST_ASSERT_EQUAL(6, i);
+
+    binary_tree_free(root);
+}
+
+void test_binary_tree_degenerate(void)
+{
+    const int count = 1000000;
+    struct node *root = node_init(0);
+    struct node *current = root;
+
+    /* Link the chain by hand, inserting sorted values one at a time would be quadratic */
+    for (int i = 1; i < count; ++i) {
+        current->right = node_init(i);
+        current = current->right;
+    }
+
+    TEST_ASSERT_EQUAL(count, binary_tree_get_height(root));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_in_tree(root, count - 1));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_bst(root, INT_MIN, INT_MAX));
+
+    binary_tree_free(root);
+}
+
+void test_binary_tree_pooled(void)
+{
+    struct binary_tree *tree = binary_tree_new();
+
+    TEST_ASSERT_NOT_NULL(tree);
+    TEST_ASSERT_NULL(tree->root);
+
+    for (int i = 0; i < 1000; ++i) {
+        TEST_ASSERT_EQUAL(1, binary_tree_add(tree, (i * 7919) % 1000));
+    }
+    TEST_ASSERT_EQUAL(0, binary_tree_add(tree, 500));
+
+    TEST_ASSERT_EQUAL(1000, binary_tree_get_node_count(tree->root));
+    TEST_ASSERT_EQUAL(0, binary_tree_get_min(tree->root));
+    TEST_ASSERT_EQUAL(999, binary_tree_get_max(tree->root));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_in_tree(tree->root, 123));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_bst(tree->root, INT_MIN, INT_MAX));
+
+    binary_tree_destroy(tree);
+}
+
+void test_binary_tree_build_sorted(void)
+{
+    const unsigned int count = 100000;
+    int *data = malloc(sizeof(*data) * count);
+
+    for (unsigned int i = 0; i < count; ++i) {
+        data[i] = (int)(i / 2);
+    }
+
+    struct binary_tree *tree = binary_tree_build_sorted(data, count);
+
+    TEST_ASSERT_EQUAL(count / 2, binary_tree_get_node_count(tree->root));
+    TEST_ASSERT_EQUAL(16, binary_tree_get_height(tree->root));
+    TEST_ASSERT_EQUAL(0, binary_tree_get_min(tree->root));
+    TEST_ASSERT_EQUAL(count / 2 - 1, binary_tree_get_max(tree->root));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_bst(tree->root, INT_MIN, INT_MAX));
+    TEST_ASSERT_EQUAL(1234, binary_tree_select(tree->root, 1234));
+
+    TEST_ASSERT_EQUAL(1, binary_tree_add(tree, -1));
+    TEST_ASSERT_EQUAL(-1, binary_tree_get_min(tree->root));
+
+    binary_tree_destroy(tree);
+    free(data);
+}
+
+void test_binary_tree_build(void)
+{
+    int data[] = {9, 3, 14, 5, -3, 4, 9};
+
+    struct binary_tree *tree = binary_tree_build(data, 7);
+
+    TEST_ASSERT_EQUAL(6, binary_tree_get_node_count(tree->root));
+    TEST_ASSERT_EQUAL(3, binary_tree_get_height(tree->root));
+    TEST_ASSERT_EQUAL(5, tree->root->data);
+    TEST_ASSERT_EQUAL(1, binary_tree_is_bst(tree->root, INT_MIN, INT_MAX));
+
+    binary_tree_destroy(tree);
+}
+
+void test_binary_tree_delete(void)
+{
+    struct node *root = node_init(15);
+
+    binary_tree_insert(root, 10);
+    binary_tree_insert(root, 7);
+    binary_tree_insert(root, 12);
+    binary_tree_insert(root, 9);
+    binary_tree_insert(root, 22);
+    binary_tree_insert(root, 20);
+
+    /* Two children, one child, leaf and missing value */
+    root = binary_tree_delete(root, 10);
+    root = binary_tree_delete(root, 22);
+    root = binary_tree_delete(root, 9);
+    root = binary_tree_delete(root, 100);
+
+    TEST_ASSERT_EQUAL(4, binary_tree_get_node_count(root));
+    TEST_ASSERT_EQUAL(0, binary_tree_is_in_tree(root, 10));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_in_tree(root, 12));
+    TEST_ASSERT_EQUAL(12, root->left->data);
+    TEST_ASSERT_EQUAL(20, binary_tree_get_max(root));
+    TEST_ASSERT_EQUAL(1, binary_tree_is_bst(root, INT_MIN, INT_MAX));
+
+    root = binary_tree_delete(root, 15);
+    TEST_ASSERT_EQUAL(3, binary_tree_get_node_count(root));
+    TEST_ASSERT_EQUAL(20, root->data);
+
+    root = binary_tree_delete(root, 20);
+    root = binary_tree_delete(root, 12);
+    root = binary_tree_delete(root, 7);
+    TEST_ASSERT_NULL(root);
+}
+
+void test_binary_tree_remove(void)
+{
+    struct binary_tree *tree = binary_tree_new();
+
+    binary_tree_add(tree, 5);
+    binary_tree_add(tree, 3);
+    binary_tree_add(tree, 9);
+
+    TEST_ASSERT_EQUAL(1, binary_tree_remove(tree, 5));
+    TEST_ASSERT_EQUAL(0, binary_tree_remove(tree, 5));
+    TEST_ASSERT_EQUAL(2, binary_tree_get_node_count(tree->root));
+
+    /* The released node is handed out again before the slab grows */
+    struct node *released = tree->free_list;
+    binary_tree_add(tree, 4);
+    TEST_ASSERT_EQUAL(4, released->data);
+    TEST_ASSERT_NULL(tree->free_list);
+
+    binary_tree_destroy(tree);
+}
+
+static void collect(int data, void *context)
+{
+    int **out = context;
+    *(*out)++ = data;
+}
+
+void test_binary_tree_range(void)
+{
+    int data[] = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+    int found[10];
+    int *out = found;
+    struct binary_tree *tree = binary_tree_build_sorted(data, 10);
+
+    TEST_ASSERT_EQUAL(4, binary_tree_range(tree->root, 6, 13, collect, &out));
+    TEST_ASSERT_EQUAL(7, found[0]);
+    TEST_ASSERT_EQUAL(9, found[1]);
+    TEST_ASSERT_EQUAL(11, found[2]);
+    TEST_ASSERT_EQUAL(13, found[3]);
+
+    out = found;
+    TEST_ASSERT_EQUAL(10, binary_tree_range(tree->root, INT_MIN, INT_MAX, collect, &out));
+    out = found;
+    TEST_ASSERT_EQUAL(0, binary_tree_range(tree->root, 20, 30, collect, &out));
+    out = found;
+    TEST_ASSERT_EQUAL(0, binary_tree_range(tree->root, 8, 8, collect, &out));
+
+    binary_tree_destroy(tree);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
     RUN_TEST(test_binary_tree_insert);
     RUN_TEST(test_binary_tree_get_node_count);
     RUN_TEST(test_binary_tree_is_in_tree);
+    RUN_TEST(test_binary_tree_is_in_tree_sorted);
     RUN_TEST(test_binary_tree_get_height);
     RUN_TEST(test_binary_tree_get_min);
     RUN_TEST(test_binary_tree_get_max);
+    RUN_TEST(test_binary_tree_rank);
+    RUN_TEST(test_binary_tree_select);
     RUN_TEST(test_binary_tree_is_bst);
     RUN_TEST(test_binary_tree_print);
+    RUN_TEST(test_binary_tree_iter);
+    RUN_TEST(test_binary_tree_degenerate);
+    RUN_TEST(test_binary_tree_pooled);
+    RUN_TEST(test_binary_tree_build_sorted);
+    RUN_TEST(test_binary_tree_build);
+    RUN_TEST(test_binary_tree_delete);
+    RUN_TEST(test_binary_tree_remove);
+    RUN_TEST(test_binary_tree_range);
     return UNITY_END();
 }
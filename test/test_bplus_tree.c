@@ -0,0 +1,133 @@
+#include <limits.h>
+
+#include "../src/bplus_tree/bplus_tree.h"
+#include "../unity/src/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_bplus_tree_new(void)
+{
+    struct bplus_tree *tree = bplus_tree_new();
+
+    TEST_ASSERT_NOT_NULL(tree);
+    TEST_ASSERT_NULL(tree->root);
+    TEST_ASSERT_EQUAL(0, bplus_tree_get_size(tree));
+    TEST_ASSERT_EQUAL(0, bplus_tree_is_in_tree(tree, 5));
+    TEST_ASSERT_EQUAL(INT_MAX, bplus_tree_get_min(tree));
+
+    bplus_tree_free(tree);
+}
+
+void test_bplus_tree_insert(void)
+{
+    struct bplus_tree *tree = bplus_tree_new();
+
+    TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, 5));
+    TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, 3));
+    TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, 9));
+    TEST_ASSERT_EQUAL(0, bplus_tree_insert(tree, 3));
+
+    TEST_ASSERT_EQUAL(3, bplus_tree_get_size(tree));
+    TEST_ASSERT_EQUAL(1, bplus_tree_is_in_tree(tree, 9));
+    TEST_ASSERT_EQUAL(0, bplus_tree_is_in_tree(tree, 4));
+    TEST_ASSERT_EQUAL(3, bplus_tree_get_min(tree));
+    TEST_ASSERT_EQUAL(9, bplus_tree_get_max(tree));
+
+    bplus_tree_free(tree);
+}
+
+void test_bplus_tree_split(void)
+{
+    struct bplus_tree *tree = bplus_tree_new();
+    const int count = 200000;
+
+    /* Scatter the keys so that splits happen all over the tree, not just on the right edge */
+    for (int i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, (int)(((long long)i * 7919) % count) * 2));
+    }
+    TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, INT_MAX));
+    TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, INT_MIN));
+
+    TEST_ASSERT_EQUAL(count + 2, bplus_tree_get_size(tree));
+    TEST_ASSERT_TRUE(tree->height > 2);
+    TEST_ASSERT_EQUAL(INT_MIN, bplus_tree_get_min(tree));
+    TEST_ASSERT_EQUAL(INT_MAX, bplus_tree_get_max(tree));
+
+    for (int i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL(1, bplus_tree_is_in_tree(tree, i * 2));
+        TEST_ASSERT_EQUAL(0, bplus_tree_is_in_tree(tree, i * 2 + 1));
+    }
+
+    bplus_tree_free(tree);
+}
+
+void test_bplus_tree_split_edges(void)
+{
+    struct bplus_tree *tree = bplus_tree_new();
+    const int count = 100000;
+
+    /* Ascending keys always split the rightmost leaf, so every level fills and the root keeps
+     * growing */
+    for (int i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, i));
+    }
+    /* Descending keys do the same along the left edge */
+    for (int i = 1; i <= count; ++i) {
+        TEST_ASSERT_EQUAL(1, bplus_tree_insert(tree, -i));
+    }
+    TEST_ASSERT_EQUAL(count * 2, bplus_tree_get_size(tree));
+    TEST_ASSERT_TRUE(tree->height > 3);
+
+    for (int i = -count; i < count; ++i) {
+        TEST_ASSERT_EQUAL(1, bplus_tree_is_in_tree(tree, i));
+        TEST_ASSERT_EQUAL(0, bplus_tree_insert(tree, i));
+    }
+    TEST_ASSERT_EQUAL(count * 2, bplus_tree_get_size(tree));
+    TEST_ASSERT_EQUAL(-count, bplus_tree_get_min(tree));
+    TEST_ASSERT_EQUAL(count - 1, bplus_tree_get_max(tree));
+
+    bplus_tree_free(tree);
+}
+
+static void collect(int data, void *context)
+{
+    int **out = context;
+    *(*out)++ = data;
+}
+
+void test_bplus_tree_range(void)
+{
+    struct bplus_tree *tree = bplus_tree_new();
+    int found[100];
+    int *out = found;
+
+    for (int i = 0; i < 1000; ++i) {
+        bplus_tree_insert(tree, i * 3);
+    }
+
+    TEST_ASSERT_EQUAL(33, bplus_tree_range(tree, 100, 200, collect, &out));
+    TEST_ASSERT_EQUAL(102, found[0]);
+    TEST_ASSERT_EQUAL(198, found[32]);
+
+    out = found;
+    TEST_ASSERT_EQUAL(0, bplus_tree_range(tree, 3000, INT_MAX, collect, &out));
+
+    bplus_tree_free(tree);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bplus_tree_new);
+    RUN_TEST(test_bplus_tree_insert);
+    RUN_TEST(test_bplus_tree_split);
+    RUN_TEST(test_bplus_tree_split_edges);
+    RUN_TEST(test_bplus_tree_range);
+    return UNITY_END();
+}
@@ -0,0 +1,70 @@
+#include <limits.h>
+
+#include "../src/binary_tree/compact_tree.h"
+#include "../unity/src/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_compact_tree_new(void)
+{
+    struct compact_tree *tree = compact_tree_new(0);
+
+    TEST_ASSERT_NOT_NULL(tree);
+    TEST_ASSERT_EQUAL(COMPACT_TREE_NIL, tree->root);
+    TEST_ASSERT_EQUAL(0, compact_tree_get_node_count(tree));
+    TEST_ASSERT_EQUAL(INT_MAX, compact_tree_get_min(tree));
+
+    compact_tree_free(tree);
+}
+
+void test_compact_tree_insert(void)
+{
+    struct compact_tree *tree = compact_tree_new(0);
+
+    TEST_ASSERT_EQUAL(1, compact_tree_insert(tree, 5));
+    TEST_ASSERT_EQUAL(1, compact_tree_insert(tree, 3));
+    TEST_ASSERT_EQUAL(1, compact_tree_insert(tree, 9));
+    TEST_ASSERT_EQUAL(1, compact_tree_insert(tree, 4));
+    TEST_ASSERT_EQUAL(0, compact_tree_insert(tree, 9));
+
+    struct compact_node *root = &tree->nodes[tree->root];
+    TEST_ASSERT_EQUAL(5, root->data);
+    TEST_ASSERT_EQUAL(3, tree->nodes[root->left].data);
+    TEST_ASSERT_EQUAL(9, tree->nodes[root->right].data);
+    TEST_ASSERT_EQUAL(4, tree->nodes[tree->nodes[root->left].right].data);
+    TEST_ASSERT_EQUAL(4, compact_tree_get_node_count(tree));
+
+    compact_tree_free(tree);
+}
+
+void test_compact_tree_grow(void)
+{
+    struct compact_tree *tree = compact_tree_new(0);
+
+    for (int i = 0; i < 10000; ++i) {
+        TEST_ASSERT_EQUAL(1, compact_tree_insert(tree, (i * 7919) % 10000));
+    }
+
+    TEST_ASSERT_EQUAL(10000, compact_tree_get_node_count(tree));
+    TEST_ASSERT_EQUAL(0, compact_tree_get_min(tree));
+    TEST_ASSERT_EQUAL(9999, compact_tree_get_max(tree));
+    TEST_ASSERT_EQUAL(1, compact_tree_is_in_tree(tree, 4242));
+    TEST_ASSERT_EQUAL(0, compact_tree_is_in_tree(tree, 10000));
+
+    compact_tree_free(tree);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_compact_tree_new);
+    RUN_TEST(test_compact_tree_insert);
+    RUN_TEST(test_compact_tree_grow);
+    return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#include <pthread.h>
+
+#include "../src/binary_tree/concurrent_tree.h"
+#include "../unity/src/unity.h"
+
+#define STABLE_KEYS 1000
+#define READER_COUNT 4
+#define GENERATIONS 5
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_concurrent_tree_insert(void)
+{
+    struct concurrent_tree *tree = concurrent_tree_new();
+
+    TEST_ASSERT_NOT_NULL(tree);
+    TEST_ASSERT_EQUAL(1, concurrent_tree_insert(tree, 5));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_insert(tree, 3));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_insert(tree, 9));
+    TEST_ASSERT_EQUAL(0, concurrent_tree_insert(tree, 9));
+
+    TEST_ASSERT_EQUAL(3, concurrent_tree_get_size(tree));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_is_in_tree(tree, 3));
+    TEST_ASSERT_EQUAL(0, concurrent_tree_is_in_tree(tree, 4));
+
+    concurrent_tree_free(tree);
+}
+
+void test_concurrent_tree_delete(void)
+{
+    struct concurrent_tree *tree = concurrent_tree_new();
+
+    concurrent_tree_insert(tree, 15);
+    concurrent_tree_insert(tree, 10);
+    concurrent_tree_insert(tree, 7);
+    concurrent_tree_insert(tree, 12);
+    concurrent_tree_insert(tree, 22);
+
+    TEST_ASSERT_EQUAL(1, concurrent_tree_delete(tree, 10));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_delete(tree, 15));
+    TEST_ASSERT_EQUAL(0, concurrent_tree_delete(tree, 15));
+
+    TEST_ASSERT_EQUAL(3, concurrent_tree_get_size(tree));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_is_in_tree(tree, 7));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_is_in_tree(tree, 12));
+    TEST_ASSERT_EQUAL(1, concurrent_tree_is_in_tree(tree, 22));
+    TEST_ASSERT_EQUAL(0, concurrent_tree_is_in_tree(tree, 10));
+
+    /* Deleted nodes are reused */
+    TEST_ASSERT_NOT_NULL(tree->free_list);
+    concurrent_tree_insert(tree, 1);
+    concurrent_tree_insert(tree, 2);
+    TEST_ASSERT_NULL(tree->free_list);
+
+    concurrent_tree_free(tree);
+}
+
+struct reader_args {
+    struct concurrent_tree *tree;
+    atomic_int *running;
+    int misses;
+};
+
+static void *reader(void *arg)
+{
+    struct reader_args *args = arg;
+
+    /* Multiples of four are never removed and odd keys are never inserted */
+    do {
+        for (int i = 0; i < STABLE_KEYS; ++i) {
+            args->misses += !concurrent_tree_is_in_tree(args->tree, i * 4);
+            args->misses += concurrent_tree_is_in_tree(args->tree, i * 4 + 1);
+        }
+    } while (atomic_load(args->running));
+
+    return NULL;
+}
+
+void test_concurrent_tree_readers(void)
+{
+    for (int generation = 0; generation < GENERATIONS; ++generation) {
+        struct concurrent_tree *tree = concurrent_tree_new();
+        struct reader_args args[READER_COUNT];
+        pthread_t threads[READER_COUNT];
+        atomic_int running = 1;
+
+        /*
+         * Interleave stable and churn keys so that many churn nodes end up with two children.
+         * Deleting those moves stable values from one node to another under the readers.
+         */
+        for (int i = 0; i < STABLE_KEYS; ++i) {
+            int key = ((i * 7919 + generation) % STABLE_KEYS) * 4;
+            concurrent_tree_insert(tree, key + ((i % 2) ? 0 : 2));
+            concurrent_tree_insert(tree, key + ((i % 2) ? 2 : 0));
+        }
+
+        for (int i = 0; i < READER_COUNT; ++i) {
+            args[i].tree = tree;
+            args[i].running = &running;
+            args[i].misses = 0;
+            pthread_create(&threads[i], NULL, reader, &args[i]);
+        }
+
+        for (int round = 0; round < 20; ++round) {
+            for (int i = 0; i < STABLE_KEYS; ++i) {
+                concurrent_tree_delete(tree, ((i * 7919 + round) % STABLE_KEYS) * 4 + 2);
+            }
+            for (int i = 0; i < STABLE_KEYS; ++i) {
+                concurrent_tree_insert(tree, ((i * 7919 + round) % STABLE_KEYS) * 4 + 2);
+            }
+        }
+        atomic_store(&running, 0);
+
+        for (int i = 0; i < READER_COUNT; ++i) {
+            pthread_join(threads[i], NULL);
+            TEST_ASSERT_EQUAL(0, args[i].misses);
+        }
+        TEST_ASSERT_EQUAL(STABLE_KEYS * 2, concurrent_tree_get_size(tree));
+
+        concurrent_tree_free(tree);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_concurrent_tree_insert);
+    RUN_TEST(test_concurrent_tree_delete);
+    RUN_TEST(test_concurrent_tree_readers);
+    return UNITY_END();
+}
@@ -0,0 +1,143 @@
+#include <limits.h>
+
+#include "../src/linked_list/dlist.h"
+#include "../unity/src/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_dlist_init(void)
+{
+    struct dlist *list = dlist_init();
+
+    TEST_ASSERT_NOT_NULL(list);
+    TEST_ASSERT_NULL(list->head);
+    TEST_ASSERT_NULL(list->tail);
+    TEST_ASSERT_EQUAL(0, list->size);
+
+    dlist_free(list);
+}
+
+void test_dlist_push_pop(void)
+{
+    struct dlist *list = dlist_init();
+
+    dlist_push_back(list, 14);
+    dlist_push_back(list, 3);
+    dlist_push_front(list, 7);
+
+    TEST_ASSERT_EQUAL(7, dlist_front(list));
+    TEST_ASSERT_EQUAL(3, dlist_back(list));
+    TEST_ASSERT_EQUAL(3, dlist_pop_back(list));
+    TEST_ASSERT_EQUAL(14, dlist_pop_back(list));
+    TEST_ASSERT_EQUAL(7, dlist_pop_back(list));
+    TEST_ASSERT_EQUAL(INT_MAX, dlist_pop_back(list));
+    TEST_ASSERT_NULL(list->head);
+    TEST_ASSERT_NULL(list->tail);
+
+    dlist_free(list);
+}
+
+void test_dlist_value_at(void)
+{
+    struct dlist *list = dlist_init();
+
+    for (int i = 0; i < 10; ++i) {
+        dlist_push_back(list, i * 2);
+    }
+
+    TEST_ASSERT_EQUAL(4, dlist_value_at(list, 2));
+    TEST_ASSERT_EQUAL(16, dlist_value_at(list, 8));
+    TEST_ASSERT_EQUAL(14, dlist_value_n_from_end(list, 2));
+    TEST_ASSERT_EQUAL(INT_MAX, dlist_value_at(list, 10));
+
+    dlist_free(list);
+}
+
+void test_dlist_node_operations(void)
+{
+    struct dlist *list = dlist_init();
+
+    struct dlist_node *middle = dlist_insert_after(list, NULL, 5);
+    dlist_insert_before(list, middle, 4);
+    struct dlist_node *last = dlist_insert_after(list, middle, 6);
+
+    TEST_ASSERT_EQUAL(3, dlist_size(list));
+    TEST_ASSERT_EQUAL_PTR(last, list->tail);
+
+    dlist_erase_node(list, middle);
+
+    TEST_ASSERT_EQUAL(2, dlist_size(list));
+    TEST_ASSERT_EQUAL(4, list->head->data);
+    TEST_ASSERT_EQUAL_PTR(list->head, last->prev);
+
+    /* Walk backwards from the tail */
+    dlist_push_back(list, 7);
+    int expected = 7;
+    for (struct dlist_node *node = list->tail; node; node = node->prev) {
+        TEST_ASSERT_EQUAL(expected, node->data);
+        expected -= (expected == 6) ? 2 : 1;
+    }
+
+    dlist_free(list);
+}
+
+void test_dlist_insert_erase(void)
+{
+    struct dlist *list = dlist_init();
+
+    dlist_push_back(list, 14);
+    dlist_push_back(list, 3);
+    dlist_push_back(list, 7);
+    dlist_insert(list, 2, 18);
+    dlist_insert(list, 0, 9);
+
+    TEST_ASSERT_EQUAL(9, dlist_front(list));
+    TEST_ASSERT_EQUAL(18, dlist_value_at(list, 3));
+
+    dlist_erase(list, 4);
+    dlist_erase(list, 0);
+    dlist_remove_value(list, 3);
+
+    TEST_ASSERT_EQUAL(2, dlist_size(list));
+    TEST_ASSERT_EQUAL(14, dlist_front(list));
+    TEST_ASSERT_EQUAL(18, dlist_back(list));
+
+    dlist_free(list);
+}
+
+void test_dlist_reverse(void)
+{
+    struct dlist *list = dlist_init();
+
+    dlist_push_back(list, 14);
+    dlist_push_back(list, 3);
+    dlist_push_back(list, 7);
+
+    dlist_reverse(list);
+
+    TEST_ASSERT_EQUAL(7, dlist_value_at(list, 0));
+    TEST_ASSERT_EQUAL(3, dlist_value_at(list, 1));
+    TEST_ASSERT_EQUAL(14, dlist_value_at(list, 2));
+    TEST_ASSERT_EQUAL(3, list->tail->prev->data);
+    TEST_ASSERT_NULL(list->head->prev);
+
+    dlist_free(list);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_dlist_init);
+    RUN_TEST(test_dlist_push_pop);
+    RUN_TEST(test_dlist_value_at);
+    RUN_TEST(test_dlist_node_operations);
+    RUN_TEST(test_dlist_insert_erase);
+    RUN_TEST(test_dlist_reverse);
+    return UNITY_END();
+}
@@ -0,0 +1,101 @@
+#include <poll.h>
+#include <pthread.h>
+
+#include "../src/queue/event_queue.h"
+#include "../unity/src/unity.h"
+
+#define ITEM_COUNT 100000
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static int readable(struct event_queue *queue, int timeout_ms)
+{
+    struct pollfd pfd = {event_queue_fd(queue), POLLIN, 0};
+    return poll(&pfd, 1, timeout_ms) == 1;
+}
+
+void test_event_queue_notify(void)
+{
+    struct event_queue *queue = event_queue_new(4);
+    int value = 0;
+
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_FALSE(readable(queue, 0));
+    TEST_ASSERT_EQUAL(0, event_queue_try_dequeue(queue, &value));
+
+    TEST_ASSERT_EQUAL(1, event_queue_enqueue(queue, 3));
+    TEST_ASSERT_TRUE(readable(queue, 0));
+    TEST_ASSERT_EQUAL(1, event_queue_enqueue(queue, 8));
+    TEST_ASSERT_TRUE(readable(queue, 0));
+
+    /* The descriptor stays readable until the queue is found empty */
+    TEST_ASSERT_EQUAL(1, event_queue_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(3, value);
+    TEST_ASSERT_EQUAL(1, event_queue_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(8, value);
+    TEST_ASSERT_TRUE(readable(queue, 0));
+    TEST_ASSERT_EQUAL(0, event_queue_try_dequeue(queue, &value));
+    TEST_ASSERT_FALSE(readable(queue, 0));
+
+    event_queue_enqueue(queue, 5);
+    TEST_ASSERT_TRUE(readable(queue, 0));
+    TEST_ASSERT_EQUAL(5, event_queue_dequeue(queue));
+
+    event_queue_free(queue);
+}
+
+static void *producer(void *arg)
+{
+    struct event_queue *queue = arg;
+
+    for (int i = 1; i <= ITEM_COUNT; ++i) {
+        event_queue_enqueue(queue, i);
+    }
+
+    return NULL;
+}
+
+void test_event_queue_event_loop(void)
+{
+    struct event_queue *queue = event_queue_new(16);
+    pthread_t thread;
+    long long sum = 0;
+    int count = 0;
+    int stalls = 0;
+
+    pthread_create(&thread, NULL, producer, queue);
+    while (count < ITEM_COUNT) {
+        /* A lost wakeup would leave the descriptor unreadable while items are queued */
+        if (!readable(queue, 1000)) {
+            ++stalls;
+            break;
+        }
+
+        int value;
+        while (event_queue_try_dequeue(queue, &value)) {
+            sum += value;
+            ++count;
+        }
+    }
+    pthread_join(thread, NULL);
+
+    TEST_ASSERT_EQUAL(0, stalls);
+    TEST_ASSERT_EQUAL(ITEM_COUNT, count);
+    TEST_ASSERT_EQUAL_INT64((long long)ITEM_COUNT * (ITEM_COUNT + 1) / 2, sum);
+
+    event_queue_free(queue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_event_queue_notify);
+    RUN_TEST(test_event_queue_event_loop);
+    return UNITY_END();
+}
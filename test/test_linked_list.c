@@ -1,3 +1,5 @@
+#include <limits.h>
+
 #include "../src/linked_list/linked_list.h"
 #include "../unity/src/unity.h"
 
@@ -149,6 +151,275 @@ void test_linked_list_reverse(void)
     linked_list_free(list);
 }
 
+void test_linked_list_remove_value(void)
+{
+    struct linked_list *list = linked_list_init();
+
+    linked_list_push_back(list, 14);
+    linked_list_push_back(list, 3);
+    linked_list_push_back(list, 7);
+
+    linked_list_remove_value(list, 42);
+    TEST_ASSERT_EQUAL(3, linked_list_size(list));
+
+    linked_list_remove_value(list, 7);
+    TEST_ASSERT_EQUAL(2, linked_list_size(list));
+    TEST_ASSERT_EQUAL(3, linked_list_back(list));
+
+    linked_list_push_back(list, 9);
+    TEST_ASSERT_EQUAL(9, linked_list_value_at(list, 2));
+
+    linked_list_free(list);
+}
+
+void test_linked_list_pool(void)
+{
+    struct node_pool *pool = node_pool_init(4);
+    struct linked_list *first = linked_list_init_with_pool(pool);
+    struct linked_list *second = linked_list_init_with_pool(pool);
+
+    for (int i = 0; i < 10; ++i) {
+        linked_list_push_back(first, i);
+        linked_list_push_front(second, i);
+    }
+    TEST_ASSERT_EQUAL(10, linked_list_size(first));
+    TEST_ASSERT_EQUAL(0, linked_list_front(first));
+    TEST_ASSERT_EQUAL(9, linked_list_back(first));
+    TEST_ASSERT_EQUAL(9, linked_list_front(second));
+
+    /* A released node is the next one handed out, by either list */
+    struct node *tail = first->tail;
+    TEST_ASSERT_EQUAL(9, linked_list_pop_back(first));
+    TEST_ASSERT_NULL(first->tail->next);
+    linked_list_push_back(second, 42);
+    TEST_ASSERT_EQUAL_PTR(tail, second->tail);
+
+    linked_list_erase(first, 4);
+    linked_list_remove_value(first, 8);
+    linked_list_reverse(first);
+    TEST_ASSERT_EQUAL(7, linked_list_size(first));
+    TEST_ASSERT_EQUAL(7, linked_list_front(first));
+    TEST_ASSERT_EQUAL(0, linked_list_back(first));
+
+    linked_list_free(first);
+    linked_list_free(second);
+    node_pool_free(pool);
+}
+
+void test_linked_list_cursor(void)
+{
+    struct linked_list *list = linked_list_init();
+    struct linked_list_cursor cursor;
+
+    for (int i = 0; i < 6; ++i) {
+        linked_list_push_back(list, i);
+    }
+
+    /* Drop the even values and follow each odd one with its double */
+    linked_list_cursor_init(&cursor, list);
+    while (linked_list_cursor_valid(&cursor)) {
+        int value = linked_list_cursor_get(&cursor);
+        if (value % 2 == 0) {
+            TEST_ASSERT_EQUAL(value, linked_list_cursor_erase(&cursor));
+        }
+        else {
+            TEST_ASSERT_EQUAL(1, linked_list_cursor_insert_after(&cursor, value * 2));
+            linked_list_cursor_next(&cursor);
+            linked_list_cursor_next(&cursor);
+        }
+    }
+    TEST_ASSERT_EQUAL(INT_MAX, linked_list_cursor_get(&cursor));
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_insert_after(&cursor, 1));
+
+    int expected[] = {1, 2, 3, 6, 5, 10};
+    TEST_ASSERT_EQUAL(6, linked_list_size(list));
+    for (int i = 0; i < 6; ++i) {
+        TEST_ASSERT_EQUAL(expected[i], linked_list_value_at(list, i));
+    }
+    TEST_ASSERT_EQUAL(10, linked_list_back(list));
+
+    /* Erasing after the second-to-last item moves the tail back */
+    linked_list_cursor_init(&cursor, list);
+    for (int i = 0; i < 4; ++i) {
+        linked_list_cursor_next(&cursor);
+    }
+    TEST_ASSERT_EQUAL(10, linked_list_cursor_erase_after(&cursor));
+    TEST_ASSERT_EQUAL(INT_MAX, linked_list_cursor_erase_after(&cursor));
+    TEST_ASSERT_EQUAL(5, linked_list_back(list));
+    linked_list_push_back(list, 7);
+    TEST_ASSERT_EQUAL(7, linked_list_value_at(list, 5));
+
+    linked_list_free(list);
+}
+
+void test_linked_list_concat(void)
+{
+    struct linked_list *first = linked_list_init();
+    struct linked_list *second = linked_list_init();
+
+    TEST_ASSERT_EQUAL(1, linked_list_concat(first, second));
+    TEST_ASSERT_TRUE(linked_list_empty(first));
+
+    linked_list_push_back(second, 3);
+    linked_list_push_back(second, 4);
+    TEST_ASSERT_EQUAL(1, linked_list_concat(first, second));
+    TEST_ASSERT_EQUAL(2, linked_list_size(first));
+    TEST_ASSERT_TRUE(linked_list_empty(second));
+    TEST_ASSERT_NULL(second->head);
+
+    linked_list_push_back(second, 5);
+    TEST_ASSERT_EQUAL(1, linked_list_concat(first, second));
+    linked_list_push_back(first, 6);
+    TEST_ASSERT_EQUAL(4, linked_list_size(first));
+    TEST_ASSERT_EQUAL(3, linked_list_front(first));
+    TEST_ASSERT_EQUAL(5, linked_list_value_at(first, 2));
+    TEST_ASSERT_EQUAL(6, linked_list_back(first));
+
+    linked_list_free(first);
+    linked_list_free(second);
+}
+
+void test_linked_list_splice(void)
+{
+    struct node_pool *pool = node_pool_init(0);
+    struct linked_list *list = linked_list_init();
+    struct linked_list *other = linked_list_init_with_pool(pool);
+
+    linked_list_push_back(list, 1);
+    linked_list_push_back(list, 4);
+    linked_list_push_back(other, 2);
+    linked_list_push_back(other, 3);
+
+    /* The lists use different pools, so the items are copied across */
+    TEST_ASSERT_EQUAL(0, linked_list_splice(list, 3, other));
+    TEST_ASSERT_EQUAL(1, linked_list_splice(list, 1, other));
+    TEST_ASSERT_EQUAL(4, linked_list_size(list));
+    TEST_ASSERT_TRUE(linked_list_empty(other));
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT_EQUAL(i + 1, linked_list_value_at(list, i));
+    }
+
+    linked_list_push_back(other, 0);
+    TEST_ASSERT_EQUAL(1, linked_list_splice(list, 0, other));
+    linked_list_push_back(other, 5);
+    TEST_ASSERT_EQUAL(1, linked_list_splice(list, 5, other));
+    TEST_ASSERT_EQUAL(6, linked_list_size(list));
+    TEST_ASSERT_EQUAL(0, linked_list_front(list));
+    TEST_ASSERT_EQUAL(5, linked_list_back(list));
+
+    linked_list_free(list);
+    linked_list_free(other);
+    node_pool_free(pool);
+}
+
+void test_linked_list_splice_into_pool(void)
+{
+    struct node_pool *pool = node_pool_init(0);
+    struct linked_list *list = linked_list_init_with_pool(pool);
+    struct linked_list *other = linked_list_init();
+
+    linked_list_push_back(list, 1);
+    linked_list_push_back(other, 2);
+    linked_list_push_back(other, 3);
+
+    TEST_ASSERT_EQUAL(1, linked_list_concat(list, other));
+    TEST_ASSERT_EQUAL(3, linked_list_size(list));
+    TEST_ASSERT_EQUAL(3, linked_list_back(list));
+    TEST_ASSERT_TRUE(linked_list_empty(other));
+    TEST_ASSERT_NULL(other->pool);
+
+    /* The source still uses malloc, so it outlives the destination's pool */
+    linked_list_free(list);
+    node_pool_free(pool);
+    linked_list_push_back(other, 4);
+    TEST_ASSERT_EQUAL(4, linked_list_front(other));
+    linked_list_free(other);
+}
+
+void test_linked_list_split(void)
+{
+    struct linked_list *list = linked_list_init();
+
+    for (int i = 0; i < 5; ++i) {
+        linked_list_push_back(list, i);
+    }
+
+    TEST_ASSERT_NULL(linked_list_split(list, 6));
+
+    struct linked_list *rest = linked_list_split(list, 2);
+    TEST_ASSERT_EQUAL(2, linked_list_size(list));
+    TEST_ASSERT_EQUAL(1, linked_list_back(list));
+    TEST_ASSERT_NULL(list->tail->next);
+    TEST_ASSERT_EQUAL(3, linked_list_size(rest));
+    TEST_ASSERT_EQUAL(2, linked_list_front(rest));
+    TEST_ASSERT_EQUAL(4, linked_list_back(rest));
+
+    struct linked_list *all = linked_list_split(rest, 0);
+    TEST_ASSERT_TRUE(linked_list_empty(rest));
+    TEST_ASSERT_EQUAL(3, linked_list_size(all));
+
+    struct linked_list *none = linked_list_split(all, 3);
+    TEST_ASSERT_TRUE(linked_list_empty(none));
+    TEST_ASSERT_EQUAL(3, linked_list_size(all));
+
+    linked_list_free(list);
+    linked_list_free(rest);
+    linked_list_free(all);
+    linked_list_free(none);
+}
+
+void test_linked_list_sort(void)
+{
+    struct linked_list *list = linked_list_init();
+
+    linked_list_sort(list);
+    TEST_ASSERT_TRUE(linked_list_empty(list));
+
+    int values[] = {5, -3, 9, 5, 0, 12, -7, 3, 3, 1, 8};
+    for (int i = 0; i < 11; ++i) {
+        linked_list_push_back(list, values[i]);
+    }
+    linked_list_sort(list);
+
+    int expected[] = {-7, -3, 0, 1, 3, 3, 5, 5, 8, 9, 12};
+    struct linked_list_cursor cursor;
+    linked_list_cursor_init(&cursor, list);
+    for (int i = 0; i < 11; ++i) {
+        TEST_ASSERT_EQUAL(expected[i], linked_list_cursor_get(&cursor));
+        linked_list_cursor_next(&cursor);
+    }
+    TEST_ASSERT_EQUAL(11, linked_list_size(list));
+    TEST_ASSERT_EQUAL(12, linked_list_back(list));
+    TEST_ASSERT_NULL(list->tail->next);
+
+    linked_list_free(list);
+}
+
+void test_linked_list_sort_parallel(void)
+{
+    struct linked_list *list = linked_list_init();
+    unsigned int count = 50001;
+
+    /* A simple permutation of 0 to count - 1 */
+    for (unsigned int i = 0; i < count; ++i) {
+        linked_list_push_back(list, (int)((i * 7919u) % count));
+    }
+    linked_list_sort_parallel(list, 5);
+
+    struct linked_list_cursor cursor;
+    linked_list_cursor_init(&cursor, list);
+    for (unsigned int i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL(i, linked_list_cursor_get(&cursor));
+        linked_list_cursor_next(&cursor);
+    }
+    TEST_ASSERT_FALSE(linked_list_cursor_valid(&cursor));
+    TEST_ASSERT_EQUAL(count, linked_list_size(list));
+    TEST_ASSERT_EQUAL(count - 1, linked_list_back(list));
+    TEST_ASSERT_NULL(list->tail->next);
+
+    linked_list_free(list);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -162,5 +433,14 @@ int main(void)
     RUN_TEST(test_linked_list_insert);
     RUN_TEST(test_linked_list_erase);
     RUN_TEST(test_linked_list_reverse);
+    RUN_TEST(test_linked_list_remove_value);
+    RUN_TEST(test_linked_list_pool);
+    RUN_TEST(test_linked_list_cursor);
+    RUN_TEST(test_linked_list_concat);
+    RUN_TEST(test_linked_list_splice);
+    RUN_TEST(test_linked_list_splice_into_pool);
+    RUN_TEST(test_linked_list_split);
+    RUN_TEST(test_linked_list_sort);
+    RUN_TEST(test_linked_list_sort_parallel);
     return UNITY_END();
 }
@@ -0,0 +1,115 @@
+#include <limits.h>
+#include <pthread.h>
+
+#include "../src/linked_list/lockfree_stack.h"
+#include "../unity/src/unity.h"
+
+#define THREAD_COUNT 4
+#define ROUNDS 20000
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_lockfree_stack_push_pop(void)
+{
+    struct lockfree_stack *stack = lockfree_stack_new(3);
+
+    TEST_ASSERT_NOT_NULL(stack);
+    TEST_ASSERT_TRUE(lockfree_stack_empty(stack));
+    TEST_ASSERT_EQUAL(INT_MAX, lockfree_stack_pop(stack));
+
+    TEST_ASSERT_EQUAL(1, lockfree_stack_push(stack, 4));
+    TEST_ASSERT_EQUAL(1, lockfree_stack_push(stack, 7));
+    TEST_ASSERT_EQUAL(1, lockfree_stack_push(stack, 2));
+    TEST_ASSERT_EQUAL(0, lockfree_stack_push(stack, 9));
+    TEST_ASSERT_FALSE(lockfree_stack_empty(stack));
+
+    TEST_ASSERT_EQUAL(2, lockfree_stack_pop(stack));
+    TEST_ASSERT_EQUAL(1, lockfree_stack_push(stack, 9));
+    TEST_ASSERT_EQUAL(9, lockfree_stack_pop(stack));
+    TEST_ASSERT_EQUAL(7, lockfree_stack_pop(stack));
+    TEST_ASSERT_EQUAL(4, lockfree_stack_pop(stack));
+    TEST_ASSERT_TRUE(lockfree_stack_empty(stack));
+
+    lockfree_stack_free(stack);
+}
+
+struct worker_args {
+    struct lockfree_stack *stack;
+    int id;
+    long long pushed;
+    long long popped;
+};
+
+static void *worker(void *arg)
+{
+    struct worker_args *args = arg;
+
+    /* Push a few values, then pop a few, so nodes are recycled between threads constantly */
+    for (int i = 0; i < ROUNDS; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            int value = args->id * ROUNDS * 3 + i * 3 + j;
+            if (lockfree_stack_push(args->stack, value)) {
+                args->pushed += value;
+            }
+        }
+        for (int j = 0; j < 3; ++j) {
+            int value = lockfree_stack_pop(args->stack);
+            if (value != INT_MAX) {
+                args->popped += value;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+void test_lockfree_stack_threads(void)
+{
+    struct lockfree_stack *stack = lockfree_stack_new(THREAD_COUNT * 2);
+    pthread_t threads[THREAD_COUNT];
+    struct worker_args args[THREAD_COUNT];
+
+    for (int i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct worker_args){stack, i, 0, 0};
+        pthread_create(&threads[i], NULL, worker, &args[i]);
+    }
+
+    long long pushed = 0;
+    long long popped = 0;
+    for (int i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+        pushed += args[i].pushed;
+        popped += args[i].popped;
+    }
+
+    /* Every value pushed was popped exactly once, or is still on the stack */
+    unsigned int left = 0;
+    while (!lockfree_stack_empty(stack)) {
+        popped += lockfree_stack_pop(stack);
+        ++left;
+    }
+    TEST_ASSERT_TRUE(left <= THREAD_COUNT * 2);
+    TEST_ASSERT_EQUAL_INT64(pushed, popped);
+
+    /* Every node made it back, so the stack can be filled to capacity again */
+    for (int i = 0; i < THREAD_COUNT * 2; ++i) {
+        TEST_ASSERT_EQUAL(1, lockfree_stack_push(stack, i));
+    }
+    TEST_ASSERT_EQUAL(0, lockfree_stack_push(stack, 0));
+
+    lockfree_stack_free(stack);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_lockfree_stack_push_pop);
+    RUN_TEST(test_lockfree_stack_threads);
+    return UNITY_END();
+}
@@ -0,0 +1,156 @@
+#include <pthread.h>
+
+#include "../src/queue/mpmc_queue.h"
+#include "../unity/src/unity.h"
+
+#define PRODUCER_COUNT 3
+#define CONSUMER_COUNT 3
+#define ITEMS_PER_PRODUCER 50000
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_mpmc_queue_try(void)
+{
+    struct mpmc_queue *queue = mpmc_queue_new(3);
+    int value = 0;
+
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_EQUAL(4, queue->capacity);
+    TEST_ASSERT_EQUAL(0, mpmc_queue_try_dequeue(queue, &value));
+
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT_EQUAL(1, mpmc_queue_try_enqueue(queue, i));
+    }
+    TEST_ASSERT_EQUAL(0, mpmc_queue_try_enqueue(queue, 4));
+    TEST_ASSERT_EQUAL(4, mpmc_queue_size(queue));
+
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT_EQUAL(1, mpmc_queue_try_dequeue(queue, &value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_EQUAL(0, mpmc_queue_size(queue));
+
+    mpmc_queue_free(queue);
+}
+
+void test_mpmc_queue_timed(void)
+{
+    struct mpmc_queue *queue = mpmc_queue_new(2);
+    int value = 0;
+
+    TEST_ASSERT_EQUAL(0, mpmc_queue_timed_dequeue(queue, &value, 10));
+
+    TEST_ASSERT_EQUAL(1, mpmc_queue_timed_enqueue(queue, 5, 10));
+    TEST_ASSERT_EQUAL(1, mpmc_queue_timed_enqueue(queue, 6, 10));
+    TEST_ASSERT_EQUAL(0, mpmc_queue_timed_enqueue(queue, 7, 10));
+
+    TEST_ASSERT_EQUAL(1, mpmc_queue_timed_dequeue(queue, &value, 10));
+    TEST_ASSERT_EQUAL(5, value);
+
+    mpmc_queue_free(queue);
+}
+
+struct consumer_args {
+    struct mpmc_queue *queue;
+    long long sum;
+    int count;
+};
+
+static void *producer(void *arg)
+{
+    struct mpmc_queue *queue = arg;
+
+    for (int i = 1; i <= ITEMS_PER_PRODUCER; ++i) {
+        mpmc_queue_enqueue(queue, i);
+    }
+
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    struct consumer_args *args = arg;
+
+    /* A zero tells the consumer to stop */
+    int value;
+    while ((value = mpmc_queue_dequeue(args->queue)) != 0) {
+        args->sum += value;
+        ++args->count;
+    }
+
+    return NULL;
+}
+
+void test_mpmc_queue_threads(void)
+{
+    struct mpmc_queue *queue = mpmc_queue_new(8);
+    pthread_t producers[PRODUCER_COUNT];
+    pthread_t consumers[CONSUMER_COUNT];
+    struct consumer_args args[CONSUMER_COUNT];
+
+    for (int i = 0; i < CONSUMER_COUNT; ++i) {
+        args[i] = (struct consumer_args){queue, 0, 0};
+        pthread_create(&consumers[i], NULL, consumer, &args[i]);
+    }
+    for (int i = 0; i < PRODUCER_COUNT; ++i) {
+        pthread_create(&producers[i], NULL, producer, queue);
+    }
+
+    for (int i = 0; i < PRODUCER_COUNT; ++i) {
+        pthread_join(producers[i], NULL);
+    }
+    for (int i = 0; i < CONSUMER_COUNT; ++i) {
+        mpmc_queue_enqueue(queue, 0);
+    }
+
+    long long sum = 0;
+    int count = 0;
+    for (int i = 0; i < CONSUMER_COUNT; ++i) {
+        pthread_join(consumers[i], NULL);
+        sum += args[i].sum;
+        count += args[i].count;
+    }
+
+    long long expected = (long long)ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2;
+    TEST_ASSERT_EQUAL(PRODUCER_COUNT * ITEMS_PER_PRODUCER, count);
+    TEST_ASSERT_EQUAL_INT64(expected * PRODUCER_COUNT, sum);
+    TEST_ASSERT_EQUAL(0, mpmc_queue_size(queue));
+
+    mpmc_queue_free(queue);
+}
+
+void test_mpmc_queue_batch(void)
+{
+    struct mpmc_queue *queue = mpmc_queue_new(8);
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10] = {0};
+
+    TEST_ASSERT_EQUAL(0, mpmc_queue_try_dequeue_batch(queue, out, 10));
+    TEST_ASSERT_EQUAL(5, mpmc_queue_try_enqueue_batch(queue, values, 5));
+    TEST_ASSERT_EQUAL(3, mpmc_queue_try_dequeue_batch(queue, out, 3));
+    TEST_ASSERT_EQUAL_INT_ARRAY(values, out, 3);
+
+    TEST_ASSERT_EQUAL(6, mpmc_queue_try_enqueue_batch(queue, &values[4], 6));
+    TEST_ASSERT_EQUAL(0, mpmc_queue_try_enqueue_batch(queue, values, 1));
+    TEST_ASSERT_EQUAL(8, mpmc_queue_try_dequeue_batch(queue, out, 10));
+    TEST_ASSERT_EQUAL_INT_ARRAY(&values[3], out, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(&values[4], &out[2], 6);
+
+    mpmc_queue_free(queue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_mpmc_queue_try);
+    RUN_TEST(test_mpmc_queue_timed);
+    RUN_TEST(test_mpmc_queue_batch);
+    RUN_TEST(test_mpmc_queue_threads);
+    return UNITY_END();
+}
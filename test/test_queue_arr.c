@@ -0,0 +1,111 @@
+#include <limits.h>
+
+#include "../src/queue/queue_arr.h"
+#include "../unity/src/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_queue_arr_new(void)
+{
+    struct queue_arr *queue = queue_arr_new(5);
+
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_EQUAL(8, queue->capacity);
+    TEST_ASSERT_EQUAL(0, queue_arr_size(queue));
+    TEST_ASSERT_EQUAL(1, queue_arr_empty(queue));
+
+    queue_arr_free(queue);
+}
+
+void test_queue_arr_enqueue(void)
+{
+    struct queue_arr *queue = queue_arr_new(4);
+
+    TEST_ASSERT_EQUAL(1, queue_arr_enqueue(queue, 4));
+    TEST_ASSERT_EQUAL(1, queue_arr_enqueue(queue, 9));
+
+    TEST_ASSERT_EQUAL(2, queue_arr_size(queue));
+    TEST_ASSERT_EQUAL(0, queue_arr_empty(queue));
+
+    queue_arr_free(queue);
+}
+
+void test_queue_arr_dequeue(void)
+{
+    struct queue_arr *queue = queue_arr_new(4);
+
+    queue_arr_enqueue(queue, 3);
+    queue_arr_enqueue(queue, 13);
+
+    TEST_ASSERT_EQUAL(3, queue_arr_dequeue(queue));
+    TEST_ASSERT_EQUAL(13, queue_arr_dequeue(queue));
+    TEST_ASSERT_EQUAL(INT_MAX, queue_arr_dequeue(queue));
+    TEST_ASSERT_EQUAL(0, queue_arr_size(queue));
+
+    queue_arr_free(queue);
+}
+
+void test_queue_arr_grow(void)
+{
+    struct queue_arr *queue = queue_arr_new(4);
+
+    /* Move the head partway round the ring so the contents wrap when the queue fills */
+    for (int i = 0; i < 3; ++i) {
+        queue_arr_enqueue(queue, -1);
+        queue_arr_dequeue(queue);
+    }
+    for (int i = 0; i < 100; ++i) {
+        TEST_ASSERT_EQUAL(1, queue_arr_enqueue(queue, i));
+    }
+    TEST_ASSERT_EQUAL(128, queue->capacity);
+    TEST_ASSERT_EQUAL(100, queue_arr_size(queue));
+
+    for (int i = 0; i < 100; ++i) {
+        TEST_ASSERT_EQUAL(i, queue_arr_dequeue(queue));
+    }
+    TEST_ASSERT_EQUAL(1, queue_arr_empty(queue));
+
+    queue_arr_free(queue);
+}
+
+void test_queue_arr_batch(void)
+{
+    struct queue_arr *queue = queue_arr_new(4);
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10] = {0};
+
+    /* Start near the end of the buffer so both copies wrap */
+    queue_arr_enqueue_batch(queue, values, 3);
+    TEST_ASSERT_EQUAL(3, queue_arr_dequeue_batch(queue, out, 3));
+
+    TEST_ASSERT_EQUAL(3, queue_arr_enqueue_batch(queue, values, 3));
+    TEST_ASSERT_EQUAL(4, queue->capacity);
+    TEST_ASSERT_EQUAL(10, queue_arr_enqueue_batch(queue, values, 10));
+    TEST_ASSERT_EQUAL(16, queue->capacity);
+    TEST_ASSERT_EQUAL(13, queue_arr_size(queue));
+
+    TEST_ASSERT_EQUAL(3, queue_arr_dequeue_batch(queue, out, 3));
+    TEST_ASSERT_EQUAL_INT_ARRAY(values, out, 3);
+    TEST_ASSERT_EQUAL(10, queue_arr_dequeue_batch(queue, out, 20));
+    TEST_ASSERT_EQUAL_INT_ARRAY(values, out, 10);
+    TEST_ASSERT_EQUAL(0, queue_arr_dequeue_batch(queue, out, 20));
+
+    queue_arr_free(queue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_queue_arr_new);
+    RUN_TEST(test_queue_arr_enqueue);
+    RUN_TEST(test_queue_arr_dequeue);
+    RUN_TEST(test_queue_arr_grow);
+    RUN_TEST(test_queue_arr_batch);
+    return UNITY_END();
+}
@@ -1,3 +1,5 @@
+#include <limits.h>
+
 #include "../src/queue//queue_ll.h"
 #include "../unity/src/unity.h"
 
@@ -57,6 +59,97 @@ void test_queue_ll_empty(void)
     queue_ll_free(queue);
 }
 
+void test_queue_ll_batch(void)
+{
+    struct queue_ll *queue = queue_ll_init();
+    int values[5] = {4, 8, 15, 16, 23};
+    int out[5] = {0};
+
+    queue_ll_enqueue(queue, 1);
+    TEST_ASSERT_EQUAL(5, queue_ll_enqueue_batch(queue, values, 5));
+    TEST_ASSERT_EQUAL(23, queue->tail->data);
+
+    TEST_ASSERT_EQUAL(1, queue_ll_dequeue(queue));
+    TEST_ASSERT_EQUAL(2, queue_ll_dequeue_batch(queue, out, 2));
+    TEST_ASSERT_EQUAL_INT_ARRAY(values, out, 2);
+    TEST_ASSERT_EQUAL(3, queue_ll_dequeue_batch(queue, out, 5));
+    TEST_ASSERT_EQUAL_INT_ARRAY(&values[2], out, 3);
+    TEST_ASSERT_EQUAL(1, queue_ll_empty(queue));
+
+    queue_ll_free(queue);
+}
+
+void test_queue_ll_try_dequeue(void)
+{
+    struct queue_ll *queue = queue_ll_init();
+    int value = 0;
+
+    TEST_ASSERT_EQUAL(0, queue_ll_try_dequeue(queue, &value));
+
+    queue_ll_enqueue(queue, INT_MAX);
+    queue_ll_enqueue(queue, 6);
+    TEST_ASSERT_EQUAL(2, queue_ll_size(queue));
+
+    TEST_ASSERT_EQUAL(1, queue_ll_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(INT_MAX, value);
+    TEST_ASSERT_EQUAL(1, queue_ll_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(6, value);
+    TEST_ASSERT_EQUAL(0, queue_ll_size(queue));
+    TEST_ASSERT_NULL(queue->tail);
+
+    queue_ll_free(queue);
+}
+
+struct watermark_counts {
+    int high;
+    int low;
+};
+
+static void count_high(struct queue_ll *queue, void *context)
+{
+    (void)queue;
+    ++((struct watermark_counts *)context)->high;
+}
+
+static void count_low(struct queue_ll *queue, void *context)
+{
+    (void)queue;
+    ++((struct watermark_counts *)context)->low;
+}
+
+void test_queue_ll_watermarks(void)
+{
+    struct queue_ll *queue = queue_ll_init();
+    struct watermark_counts counts = {0, 0};
+    int values[4] = {0};
+
+    queue_ll_set_watermarks(queue, 4, 1, count_high, count_low, &counts);
+
+    for (int i = 0; i < 3; ++i) {
+        queue_ll_enqueue(queue, i);
+    }
+    TEST_ASSERT_EQUAL(0, counts.high);
+    queue_ll_enqueue(queue, 3);
+    TEST_ASSERT_EQUAL(1, counts.high);
+
+    /* Hovering around the high watermark does not call back again */
+    queue_ll_dequeue(queue);
+    queue_ll_enqueue(queue, 4);
+    TEST_ASSERT_EQUAL(1, counts.high);
+    TEST_ASSERT_EQUAL(0, counts.low);
+
+    TEST_ASSERT_EQUAL(3, queue_ll_dequeue_batch(queue, values, 3));
+    TEST_ASSERT_EQUAL(1, counts.low);
+    queue_ll_dequeue(queue);
+    TEST_ASSERT_EQUAL(1, counts.low);
+
+    TEST_ASSERT_EQUAL(4, queue_ll_enqueue_batch(queue, values, 4));
+    TEST_ASSERT_EQUAL(2, counts.high);
+    TEST_ASSERT_EQUAL(4, queue_ll_size(queue));
+
+    queue_ll_free(queue);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -64,5 +157,8 @@ int main(void)
     RUN_TEST(test_queue_ll_enqueue);
     RUN_TEST(test_queue_ll_dequeue);
     RUN_TEST(test_queue_ll_empty);
+    RUN_TEST(test_queue_ll_batch);
+    RUN_TEST(test_queue_ll_try_dequeue);
+    RUN_TEST(test_queue_ll_watermarks);
     return UNITY_END();
 }
@@ -0,0 +1,101 @@
+#include <stdatomic.h>
+
+#include "../src/queue/scheduler.h"
+#include "../unity/src/unity.h"
+
+#define TASK_COUNT 10000
+#define WORKER_COUNT 4
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static atomic_long total;
+
+static void add_one(void *arg)
+{
+    (void)arg;
+    atomic_fetch_add(&total, 1);
+}
+
+void test_scheduler_submit(void)
+{
+    struct scheduler *scheduler = scheduler_new(WORKER_COUNT);
+
+    TEST_ASSERT_NOT_NULL(scheduler);
+
+    atomic_store(&total, 0);
+    for (int i = 0; i < TASK_COUNT; ++i) {
+        TEST_ASSERT_EQUAL(1, scheduler_submit(scheduler, add_one, NULL));
+    }
+    scheduler_wait(scheduler);
+    TEST_ASSERT_EQUAL(TASK_COUNT, atomic_load(&total));
+
+    /* The scheduler can be reused after a wait */
+    scheduler_submit(scheduler, add_one, NULL);
+    scheduler_wait(scheduler);
+    TEST_ASSERT_EQUAL(TASK_COUNT + 1, atomic_load(&total));
+
+    scheduler_free(scheduler);
+}
+
+struct range {
+    struct scheduler *scheduler;
+    long low;
+    long high;
+};
+
+static struct range ranges[1 << 16];
+static atomic_int next_range;
+
+/* Sum a range of numbers by splitting it in half until the pieces are small */
+static void sum_range(void *arg)
+{
+    struct range *range = arg;
+
+    if (range->high - range->low <= 64) {
+        long sum = 0;
+        for (long i = range->low; i < range->high; ++i) {
+            sum += i;
+        }
+        atomic_fetch_add(&total, sum);
+        return;
+    }
+
+    long middle = range->low + (range->high - range->low) / 2;
+    struct range *left = &ranges[atomic_fetch_add(&next_range, 2)];
+    struct range *right = left + 1;
+    *left = (struct range){range->scheduler, range->low, middle};
+    *right = (struct range){range->scheduler, middle, range->high};
+
+    scheduler_submit(range->scheduler, sum_range, left);
+    scheduler_submit(range->scheduler, sum_range, right);
+}
+
+void test_scheduler_nested(void)
+{
+    struct scheduler *scheduler = scheduler_new(WORKER_COUNT);
+    long count = 1000000;
+
+    atomic_store(&total, 0);
+    atomic_store(&next_range, 1);
+    ranges[0] = (struct range){scheduler, 0, count};
+
+    scheduler_submit(scheduler, sum_range, &ranges[0]);
+    scheduler_wait(scheduler);
+    TEST_ASSERT_EQUAL_INT64(count * (count - 1) / 2, atomic_load(&total));
+
+    scheduler_free(scheduler);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_scheduler_submit);
+    RUN_TEST(test_scheduler_nested);
+    return UNITY_END();
+}
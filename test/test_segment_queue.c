@@ -0,0 +1,176 @@
+#include <limits.h>
+
+#include "../src/queue/segment_queue.h"
+#include "../unity/src/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_segment_queue_init(void)
+{
+    struct segment_queue *queue = segment_queue_init();
+
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_NULL(queue->head);
+    TEST_ASSERT_NULL(queue->tail);
+    TEST_ASSERT_EQUAL(1, segment_queue_empty(queue));
+
+    segment_queue_free(queue);
+}
+
+void test_segment_queue_enqueue_dequeue(void)
+{
+    struct segment_queue *queue = segment_queue_init();
+
+    segment_queue_enqueue(queue, 3);
+    segment_queue_enqueue(queue, 13);
+    TEST_ASSERT_EQUAL(2, segment_queue_size(queue));
+
+    TEST_ASSERT_EQUAL(3, segment_queue_dequeue(queue));
+    TEST_ASSERT_EQUAL(13, segment_queue_dequeue(queue));
+    TEST_ASSERT_EQUAL(INT_MAX, segment_queue_dequeue(queue));
+    TEST_ASSERT_EQUAL(1, segment_queue_empty(queue));
+
+    segment_queue_free(queue);
+}
+
+void test_segment_queue_segments(void)
+{
+    struct segment_queue *queue = segment_queue_init();
+    int count = SEGMENT_QUEUE_SEGMENT_CAPACITY * 3 + 10;
+
+    for (int i = 0; i < count; ++i) {
+        segment_queue_enqueue(queue, i);
+    }
+    TEST_ASSERT_EQUAL(count, segment_queue_size(queue));
+    TEST_ASSERT_NOT_NULL(queue->head->next);
+
+    /* Reading past the first segment keeps it as a spare */
+    for (int i = 0; i < SEGMENT_QUEUE_SEGMENT_CAPACITY; ++i) {
+        TEST_ASSERT_EQUAL(i, segment_queue_dequeue(queue));
+    }
+    struct queue_segment *spare = queue->spare;
+    TEST_ASSERT_NOT_NULL(spare);
+
+    for (int i = SEGMENT_QUEUE_SEGMENT_CAPACITY; i < count; ++i) {
+        TEST_ASSERT_EQUAL(i, segment_queue_dequeue(queue));
+    }
+    TEST_ASSERT_EQUAL(1, segment_queue_empty(queue));
+
+    /* The spare is used before a new segment is allocated */
+    spare = queue->spare;
+    for (int i = 0; i < SEGMENT_QUEUE_SEGMENT_CAPACITY + 1; ++i) {
+        segment_queue_enqueue(queue, i);
+    }
+    TEST_ASSERT_EQUAL_PTR(spare, queue->tail);
+    TEST_ASSERT_NULL(queue->spare);
+    TEST_ASSERT_EQUAL(0, segment_queue_dequeue(queue));
+
+    segment_queue_free(queue);
+}
+
+void test_segment_queue_batch(void)
+{
+    struct segment_queue *queue = segment_queue_init();
+    int count = SEGMENT_QUEUE_SEGMENT_CAPACITY * 2 + 7;
+    int values[SEGMENT_QUEUE_SEGMENT_CAPACITY * 2 + 7];
+    int out[SEGMENT_QUEUE_SEGMENT_CAPACITY * 2 + 7];
+
+    for (int i = 0; i < count; ++i) {
+        values[i] = i;
+    }
+
+    /* Start partway into a segment so the batch spans three of them */
+    segment_queue_enqueue(queue, -1);
+    TEST_ASSERT_EQUAL(count, segment_queue_enqueue_batch(queue, values, count));
+    TEST_ASSERT_EQUAL(count + 1, segment_queue_size(queue));
+    TEST_ASSERT_NOT_NULL(queue->head->next->next);
+
+    TEST_ASSERT_EQUAL(-1, segment_queue_dequeue(queue));
+    TEST_ASSERT_EQUAL(10, segment_queue_dequeue_batch(queue, out, 10));
+    TEST_ASSERT_EQUAL_INT_ARRAY(values, out, 10);
+    TEST_ASSERT_EQUAL(count - 10, segment_queue_dequeue_batch(queue, out, count));
+    TEST_ASSERT_EQUAL_INT_ARRAY(&values[10], out, count - 10);
+    TEST_ASSERT_EQUAL(1, segment_queue_empty(queue));
+    TEST_ASSERT_EQUAL(0, segment_queue_dequeue_batch(queue, out, count));
+
+    segment_queue_free(queue);
+}
+
+void test_segment_queue_try_dequeue(void)
+{
+    struct segment_queue *queue = segment_queue_init();
+    int value = 0;
+
+    TEST_ASSERT_EQUAL(0, segment_queue_try_dequeue(queue, &value));
+
+    segment_queue_enqueue(queue, INT_MAX);
+    segment_queue_enqueue(queue, 6);
+
+    TEST_ASSERT_EQUAL(1, segment_queue_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(INT_MAX, value);
+    TEST_ASSERT_EQUAL(1, segment_queue_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(6, value);
+    TEST_ASSERT_EQUAL(0, segment_queue_size(queue));
+
+    segment_queue_free(queue);
+}
+
+struct watermark_counts {
+    int high;
+    int low;
+};
+
+static void count_high(struct segment_queue *queue, void *context)
+{
+    (void)queue;
+    ++((struct watermark_counts *)context)->high;
+}
+
+static void count_low(struct segment_queue *queue, void *context)
+{
+    (void)queue;
+    ++((struct watermark_counts *)context)->low;
+}
+
+void test_segment_queue_watermarks(void)
+{
+    struct segment_queue *queue = segment_queue_init();
+    struct watermark_counts counts = {0, 0};
+    int values[4] = {0};
+
+    segment_queue_set_watermarks(queue, 4, 1, count_high, count_low, &counts);
+
+    TEST_ASSERT_EQUAL(3, segment_queue_enqueue_batch(queue, values, 3));
+    TEST_ASSERT_EQUAL(0, counts.high);
+    segment_queue_enqueue(queue, 3);
+    TEST_ASSERT_EQUAL(1, counts.high);
+
+    /* Hovering around the high watermark does not call back again */
+    segment_queue_dequeue(queue);
+    segment_queue_enqueue(queue, 4);
+    TEST_ASSERT_EQUAL(1, counts.high);
+    TEST_ASSERT_EQUAL(0, counts.low);
+
+    TEST_ASSERT_EQUAL(3, segment_queue_dequeue_batch(queue, values, 3));
+    TEST_ASSERT_EQUAL(1, counts.low);
+
+    segment_queue_free(queue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_segment_queue_init);
+    RUN_TEST(test_segment_queue_enqueue_dequeue);
+    RUN_TEST(test_segment_queue_segments);
+    RUN_TEST(test_segment_queue_batch);
+    RUN_TEST(test_segment_queue_try_dequeue);
+    RUN_TEST(test_segment_queue_watermarks);
+    return UNITY_END();
+}
@@ -0,0 +1,116 @@
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/queue/spsc_queue.h"
+#include "../unity/src/unity.h"
+
+#define ITEM_COUNT 1000000
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_spsc_queue_new(void)
+{
+    struct spsc_queue *queue = spsc_queue_new(5);
+
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_EQUAL(8, queue->capacity);
+    TEST_ASSERT_EQUAL(0, spsc_queue_size(queue));
+
+    spsc_queue_free(queue);
+}
+
+void test_spsc_queue_enqueue_dequeue(void)
+{
+    struct spsc_queue *queue = spsc_queue_new(4);
+    int value = 0;
+
+    TEST_ASSERT_EQUAL(0, spsc_queue_try_dequeue(queue, &value));
+
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT_EQUAL(1, spsc_queue_try_enqueue(queue, i));
+    }
+    TEST_ASSERT_EQUAL(0, spsc_queue_try_enqueue(queue, 4));
+    TEST_ASSERT_EQUAL(4, spsc_queue_size(queue));
+
+    TEST_ASSERT_EQUAL(1, spsc_queue_try_dequeue(queue, &value));
+    TEST_ASSERT_EQUAL(0, value);
+    TEST_ASSERT_EQUAL(1, spsc_queue_try_enqueue(queue, 4));
+
+    for (int i = 1; i < 5; ++i) {
+        TEST_ASSERT_EQUAL(1, spsc_queue_try_dequeue(queue, &value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_EQUAL(0, spsc_queue_try_dequeue(queue, &value));
+
+    spsc_queue_free(queue);
+}
+
+static void *producer(void *arg)
+{
+    struct spsc_queue *queue = arg;
+
+    for (int i = 0; i < ITEM_COUNT; ++i) {
+        while (!spsc_queue_try_enqueue(queue, i)) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+void test_spsc_queue_threads(void)
+{
+    struct spsc_queue *queue = spsc_queue_new(64);
+    pthread_t thread;
+    int out_of_order = 0;
+
+    pthread_create(&thread, NULL, producer, queue);
+    for (int i = 0; i < ITEM_COUNT; ++i) {
+        int value;
+        while (!spsc_queue_try_dequeue(queue, &value)) {
+            sched_yield();
+        }
+        out_of_order += (value != i);
+    }
+    pthread_join(thread, NULL);
+
+    TEST_ASSERT_EQUAL(0, out_of_order);
+    TEST_ASSERT_EQUAL(0, spsc_queue_size(queue));
+
+    spsc_queue_free(queue);
+}
+
+void test_spsc_queue_batch(void)
+{
+    struct spsc_queue *queue = spsc_queue_new(8);
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10] = {0};
+
+    TEST_ASSERT_EQUAL(5, spsc_queue_try_enqueue_batch(queue, values, 5));
+    TEST_ASSERT_EQUAL(5, spsc_queue_try_dequeue_batch(queue, out, 10));
+
+    /* Only eight fit, and they wrap around the end of the ring */
+    TEST_ASSERT_EQUAL(8, spsc_queue_try_enqueue_batch(queue, values, 10));
+    TEST_ASSERT_EQUAL(0, spsc_queue_try_enqueue_batch(queue, values, 1));
+    TEST_ASSERT_EQUAL(8, spsc_queue_try_dequeue_batch(queue, out, 10));
+    TEST_ASSERT_EQUAL_INT_ARRAY(values, out, 8);
+    TEST_ASSERT_EQUAL(0, spsc_queue_try_dequeue_batch(queue, out, 10));
+
+    spsc_queue_free(queue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_spsc_queue_new);
+    RUN_TEST(test_spsc_queue_enqueue_dequeue);
+    RUN_TEST(test_spsc_queue_batch);
+    RUN_TEST(test_spsc_queue_threads);
+    return UNITY_END();
+}
@@ -0,0 +1,90 @@
+#include <stdint.h>
+
+#include "../src/binary_tree/typed_tree.h"
+#include "../unity/src/unity.h"
+
+struct point {
+    int x;
+    int y;
+};
+
+#define POINT_LESS(a, b) ((a).x < (b).x || ((a).x == (b).x && (a).y < (b).y))
+
+TYPED_TREE_DEFINE(id_tree, int64_t, TYPED_TREE_LESS)
+TYPED_TREE_DEFINE(real_tree, double, TYPED_TREE_LESS)
+TYPED_TREE_DEFINE(point_tree, struct point, POINT_LESS)
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_typed_tree_int64(void)
+{
+    struct id_tree_node *root = NULL;
+
+    TEST_ASSERT_EQUAL(1, id_tree_insert(&root, 5000000000LL));
+    TEST_ASSERT_EQUAL(1, id_tree_insert(&root, -7));
+    TEST_ASSERT_EQUAL(1, id_tree_insert(&root, 9000000000LL));
+    TEST_ASSERT_EQUAL(0, id_tree_insert(&root, 5000000000LL));
+
+    TEST_ASSERT_TRUE(root->key == 5000000000LL);
+    TEST_ASSERT_NULL(root->left->left);
+    TEST_ASSERT_NULL(root->right->right);
+    TEST_ASSERT_EQUAL(1, id_tree_is_in_tree(root, 9000000000LL));
+    TEST_ASSERT_EQUAL(0, id_tree_is_in_tree(root, 9000000001LL));
+    TEST_ASSERT_TRUE(id_tree_get_min(root)->key == -7);
+    TEST_ASSERT_TRUE(id_tree_get_max(root)->key == 9000000000LL);
+
+    id_tree_free(root);
+}
+
+void test_typed_tree_double(void)
+{
+    struct real_tree_node *root = NULL;
+
+    TEST_ASSERT_NULL(real_tree_get_min(root));
+
+    TEST_ASSERT_EQUAL(1, real_tree_insert(&root, 0.5));
+    TEST_ASSERT_EQUAL(1, real_tree_insert(&root, 0.25));
+    TEST_ASSERT_EQUAL(1, real_tree_insert(&root, 0.75));
+
+    TEST_ASSERT_EQUAL(1, real_tree_is_in_tree(root, 0.25));
+    TEST_ASSERT_EQUAL(0, real_tree_is_in_tree(root, 0.3));
+    TEST_ASSERT_TRUE(real_tree_get_max(root)->key == 0.75);
+
+    real_tree_free(root);
+}
+
+void test_typed_tree_composite(void)
+{
+    struct point_tree_node *root = NULL;
+    struct point a = {1, 2};
+    struct point b = {1, 3};
+    struct point c = {0, 9};
+    struct point missing = {2, 2};
+
+    TEST_ASSERT_EQUAL(1, point_tree_insert(&root, a));
+    TEST_ASSERT_EQUAL(1, point_tree_insert(&root, b));
+    TEST_ASSERT_EQUAL(1, point_tree_insert(&root, c));
+
+    TEST_ASSERT_EQUAL(1, point_tree_is_in_tree(root, b));
+    TEST_ASSERT_EQUAL(0, point_tree_is_in_tree(root, missing));
+    TEST_ASSERT_EQUAL(0, point_tree_get_min(root)->key.x);
+    TEST_ASSERT_EQUAL(3, point_tree_get_max(root)->key.y);
+    TEST_ASSERT_EQUAL_PTR(root->right, point_tree_find(root, b));
+
+    point_tree_free(root);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_typed_tree_int64);
+    RUN_TEST(test_typed_tree_double);
+    RUN_TEST(test_typed_tree_composite);
+    return UNITY_END();
+}
@@ -0,0 +1,161 @@
+#include <limits.h>
+
+#include "../src/linked_list/unrolled_list.h"
+#include "../unity/src/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_unrolled_list_init(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    TEST_ASSERT_NOT_NULL(list);
+    TEST_ASSERT_NULL(list->head);
+    TEST_ASSERT_NULL(list->tail);
+    TEST_ASSERT_EQUAL(0, list->size);
+
+    unrolled_list_free(list);
+}
+
+void test_unrolled_list_push_front(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    for (int i = 0; i < 100; ++i) {
+        unrolled_list_push_front(list, i);
+    }
+
+    TEST_ASSERT_EQUAL(100, unrolled_list_size(list));
+    TEST_ASSERT_EQUAL(99, unrolled_list_value_at(list, 0));
+    TEST_ASSERT_EQUAL(0, unrolled_list_value_at(list, 99));
+    TEST_ASSERT_EQUAL(0, unrolled_list_back(list));
+
+    unrolled_list_free(list);
+}
+
+void test_unrolled_list_push_back(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    for (int i = 0; i < 100; ++i) {
+        unrolled_list_push_back(list, i);
+    }
+
+    TEST_ASSERT_EQUAL(100, unrolled_list_size(list));
+    TEST_ASSERT_EQUAL(0, unrolled_list_front(list));
+    TEST_ASSERT_EQUAL(42, unrolled_list_value_at(list, 42));
+    TEST_ASSERT_EQUAL(97, unrolled_list_value_n_from_end(list, 2));
+    TEST_ASSERT_EQUAL(INT_MAX, unrolled_list_value_at(list, 100));
+
+    unrolled_list_free(list);
+}
+
+void test_unrolled_list_pop(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    for (int i = 0; i < 30; ++i) {
+        unrolled_list_push_back(list, i);
+    }
+
+    TEST_ASSERT_EQUAL(0, unrolled_list_pop_front(list));
+    TEST_ASSERT_EQUAL(29, unrolled_list_pop_back(list));
+
+    for (int i = 28; i >= 15; --i) {
+        TEST_ASSERT_EQUAL(i, unrolled_list_pop_back(list));
+    }
+    for (int i = 1; i < 15; ++i) {
+        TEST_ASSERT_EQUAL(i, unrolled_list_pop_front(list));
+    }
+
+    TEST_ASSERT_EQUAL(1, unrolled_list_empty(list));
+    TEST_ASSERT_NULL(list->head);
+    TEST_ASSERT_NULL(list->tail);
+    TEST_ASSERT_EQUAL(INT_MAX, unrolled_list_pop_front(list));
+
+    unrolled_list_free(list);
+}
+
+void test_unrolled_list_insert(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    for (int i = 0; i < UNROLLED_LIST_NODE_CAPACITY; ++i) {
+        unrolled_list_push_back(list, i * 10);
+    }
+
+    /* The single node is full, so this insert splits it */
+    unrolled_list_insert(list, 10, 95);
+    unrolled_list_insert(list, 0, -1);
+
+    TEST_ASSERT_EQUAL(UNROLLED_LIST_NODE_CAPACITY + 2, unrolled_list_size(list));
+    TEST_ASSERT_EQUAL(-1, unrolled_list_front(list));
+    TEST_ASSERT_EQUAL(90, unrolled_list_value_at(list, 10));
+    TEST_ASSERT_EQUAL(95, unrolled_list_value_at(list, 11));
+    TEST_ASSERT_EQUAL(100, unrolled_list_value_at(list, 12));
+    TEST_ASSERT_EQUAL(120, unrolled_list_back(list));
+
+    unrolled_list_free(list);
+}
+
+void test_unrolled_list_erase(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    for (int i = 0; i < 40; ++i) {
+        unrolled_list_push_back(list, i);
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        unrolled_list_erase(list, i);
+    }
+
+    TEST_ASSERT_EQUAL(20, unrolled_list_size(list));
+    for (int i = 0; i < 20; ++i) {
+        TEST_ASSERT_EQUAL(i * 2 + 1, unrolled_list_value_at(list, i));
+    }
+
+    unrolled_list_remove_value(list, 39);
+    unrolled_list_remove_value(list, 100);
+    TEST_ASSERT_EQUAL(19, unrolled_list_size(list));
+    TEST_ASSERT_EQUAL(37, unrolled_list_back(list));
+
+    unrolled_list_free(list);
+}
+
+void test_unrolled_list_reverse(void)
+{
+    struct unrolled_list *list = unrolled_list_init();
+
+    for (int i = 0; i < 30; ++i) {
+        unrolled_list_push_back(list, i);
+    }
+
+    unrolled_list_reverse(list);
+
+    for (int i = 0; i < 30; ++i) {
+        TEST_ASSERT_EQUAL(29 - i, unrolled_list_value_at(list, i));
+    }
+    TEST_ASSERT_EQUAL(0, unrolled_list_back(list));
+
+    unrolled_list_free(list);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_unrolled_list_init);
+    RUN_TEST(test_unrolled_list_push_front);
+    RUN_TEST(test_unrolled_list_push_back);
+    RUN_TEST(test_unrolled_list_pop);
+    RUN_TEST(test_unrolled_list_insert);
+    RUN_TEST(test_unrolled_list_erase);
+    RUN_TEST(test_unrolled_list_reverse);
+    return UNITY_END();
+}
@@ -0,0 +1,138 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "../src/queue/ws_deque.h"
+#include "../unity/src/unity.h"
+
+#define ITEM_COUNT 100000
+#define THIEF_COUNT 3
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* Items are pointers, so small integers are stored as fake pointers offset by one */
+static void *item(intptr_t value)
+{
+    return (void *)(value + 1);
+}
+
+static intptr_t value_of(void *item)
+{
+    return (intptr_t)item - 1;
+}
+
+void test_ws_deque_push_pop(void)
+{
+    struct ws_deque *deque = ws_deque_new(4);
+
+    TEST_ASSERT_NOT_NULL(deque);
+    TEST_ASSERT_NULL(ws_deque_pop(deque));
+    TEST_ASSERT_NULL(ws_deque_steal(deque));
+
+    /* Push enough to grow the buffer a few times */
+    for (intptr_t i = 0; i < 100; ++i) {
+        TEST_ASSERT_EQUAL(1, ws_deque_push(deque, item(i)));
+    }
+    TEST_ASSERT_EQUAL(100, ws_deque_size(deque));
+
+    /* The owner takes the newest items and thieves take the oldest */
+    TEST_ASSERT_EQUAL(99, value_of(ws_deque_pop(deque)));
+    TEST_ASSERT_EQUAL(0, value_of(ws_deque_steal(deque)));
+    TEST_ASSERT_EQUAL(1, value_of(ws_deque_steal(deque)));
+    TEST_ASSERT_EQUAL(98, value_of(ws_deque_pop(deque)));
+    TEST_ASSERT_EQUAL(96, ws_deque_size(deque));
+
+    for (intptr_t i = 97; i >= 2; --i) {
+        TEST_ASSERT_EQUAL(i, value_of(ws_deque_pop(deque)));
+    }
+    TEST_ASSERT_NULL(ws_deque_pop(deque));
+    TEST_ASSERT_EQUAL(0, ws_deque_size(deque));
+
+    ws_deque_free(deque);
+}
+
+struct thief_args {
+    struct ws_deque *deque;
+    atomic_int *done;
+    unsigned char *seen;
+    int stolen;
+};
+
+static void *thief(void *arg)
+{
+    struct thief_args *args = arg;
+
+    while (!atomic_load(args->done) || ws_deque_size(args->deque) > 0) {
+        void *stolen = ws_deque_steal(args->deque);
+        if (stolen) {
+            ++args->seen[value_of(stolen)];
+            ++args->stolen;
+        }
+    }
+
+    return NULL;
+}
+
+void test_ws_deque_threads(void)
+{
+    static unsigned char seen[THIEF_COUNT + 1][ITEM_COUNT];
+    struct ws_deque *deque = ws_deque_new(16);
+    pthread_t threads[THIEF_COUNT];
+    struct thief_args args[THIEF_COUNT];
+    atomic_int done = 0;
+
+    for (int i = 0; i < THIEF_COUNT; ++i) {
+        args[i] = (struct thief_args){deque, &done, seen[i + 1], 0};
+        pthread_create(&threads[i], NULL, thief, &args[i]);
+    }
+
+    /* The owner pushes in bursts and pops some back, racing the thieves for the last item */
+    for (intptr_t i = 0; i < ITEM_COUNT; ++i) {
+        ws_deque_push(deque, item(i));
+        if (i % 3 == 0) {
+            void *popped = ws_deque_pop(deque);
+            if (popped) {
+                ++seen[0][value_of(popped)];
+            }
+        }
+    }
+    void *popped;
+    while ((popped = ws_deque_pop(deque))) {
+        ++seen[0][value_of(popped)];
+    }
+    atomic_store(&done, 1);
+
+    for (int i = 0; i < THIEF_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    /* Every item was taken exactly once, by the owner or by one thief */
+    int duplicates = 0;
+    int missing = 0;
+    for (int i = 0; i < ITEM_COUNT; ++i) {
+        int times = 0;
+        for (int j = 0; j <= THIEF_COUNT; ++j) {
+            times += seen[j][i];
+        }
+        duplicates += times > 1;
+        missing += times == 0;
+    }
+    TEST_ASSERT_EQUAL(0, duplicates);
+    TEST_ASSERT_EQUAL(0, missing);
+
+    ws_deque_free(deque);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_ws_deque_push_pop);
+    RUN_TEST(test_ws_deque_threads);
+    return UNITY_END();
+}